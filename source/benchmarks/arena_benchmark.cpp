@@ -0,0 +1,101 @@
+#include "benchmark.hpp"
+#include "newtype/allocator.hpp"
+#include "newtype/newtype.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdio>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace arena_benchmark
+{
+
+  using field = nt::new_type<std::string, struct field_tag, deriving(nt::Indirection)>;
+  using pmr_field = nt::new_type<std::pmr::string, struct pmr_field_tag, deriving(nt::Indirection)>;
+
+  auto constexpr fields_per_request = std::size_t{64};
+
+  auto make_request() -> std::string
+  {
+    auto request = std::string{};
+    for (auto index = std::size_t{}; index < fields_per_request; ++index)
+    {
+      request += "a field value that does not fit into the small buffer ";
+      request += std::to_string(index);
+      request += ',';
+    }
+    return request;
+  }
+
+  template<typename ContainerType>
+  auto split(std::string_view request, ContainerType & fields) -> std::size_t
+  {
+    auto bytes = std::size_t{};
+    while (!request.empty())
+    {
+      auto end = request.find(',');
+      fields.emplace_back(std::in_place, request.substr(0, end));
+      bytes += fields.back()->size();
+      request.remove_prefix(end + 1);
+    }
+    return bytes;
+  }
+
+  auto parse_default(std::string_view request) -> std::size_t
+  {
+    auto fields = std::vector<field>{};
+    return split(request, fields);
+  }
+
+  auto parse_default_resource(std::string_view request) -> std::size_t
+  {
+    auto fields = std::pmr::vector<pmr_field>{};
+    return split(request, fields);
+  }
+
+  auto parse_arena_without_propagation(std::string_view request, std::array<std::byte, 16384> & buffer) -> std::size_t
+  {
+    auto arena = std::pmr::monotonic_buffer_resource{buffer.data(), buffer.size(), std::pmr::null_memory_resource()};
+    auto fields = std::pmr::vector<field>{&arena};
+    return split(request, fields);
+  }
+
+  auto parse_arena(std::string_view request, std::array<std::byte, 16384> & buffer) -> std::size_t
+  {
+    auto arena = std::pmr::monotonic_buffer_resource{buffer.data(), buffer.size(), std::pmr::null_memory_resource()};
+    auto fields = std::pmr::vector<pmr_field>{&arena};
+    return split(request, fields);
+  }
+
+}  // namespace arena_benchmark
+
+auto main(int argc, char ** argv) -> int
+{
+  using namespace arena_benchmark;
+
+  auto const requests = benchmark::size_argument(argc, argv, 100'000);
+  auto const request = make_request();
+  auto buffer = std::array<std::byte, 16384>{};
+  std::printf("%zu requests of %zu fields, best of %d runs\n", requests, fields_per_request, benchmark::repetitions);
+
+  auto run = [&](auto parse) {
+    auto bytes = std::size_t{};
+    for (auto index = std::size_t{}; index < requests; ++index)
+    {
+      bytes += parse(request);
+    }
+    return bytes;
+  };
+
+  benchmark::report_time("std::vector<new_type<std::string>>", requests, [&] { return run(parse_default); });
+  benchmark::report_time("pmr::vector default resource", requests, [&] { return run(parse_default_resource); });
+  benchmark::report_time("pmr::vector arena, strings on the heap", requests, [&] {
+    return run([&](std::string_view request) { return parse_arena_without_propagation(request, buffer); });
+  });
+  benchmark::report_time("pmr::vector monotonic arena", requests, [&] {
+    return run([&](std::string_view request) { return parse_arena(request, buffer); });
+  });
+}
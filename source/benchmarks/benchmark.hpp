@@ -0,0 +1,68 @@
+#ifndef NEWTYPE_BENCHMARKS_BENCHMARK_HPP
+#define NEWTYPE_BENCHMARKS_BENCHMARK_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+
+namespace benchmark
+{
+
+  auto constexpr repetitions = 5;
+
+  template<typename ValueType>
+  auto do_not_optimize(ValueType const & value) -> void
+  {
+#if defined(__GNUC__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    auto volatile sink = &value;
+    static_cast<void>(sink);
+#endif
+  }
+
+  inline auto size_argument(int argc, char ** argv, std::size_t fallback) -> std::size_t
+  {
+    return argc > 1 ? std::strtoull(argv[1], nullptr, 10) : fallback;
+  }
+
+  template<typename Function>
+  auto best_of(Function function, std::size_t & checksum) -> double
+  {
+    checksum += function();
+    auto best = std::chrono::duration<double>::max();
+    for (auto repetition = 0; repetition < repetitions; ++repetition)
+    {
+      auto const start = std::chrono::steady_clock::now();
+      checksum += function();
+      best = std::min<std::chrono::duration<double>>(best, std::chrono::steady_clock::now() - start);
+    }
+    return best.count();
+  }
+
+  template<typename Function>
+  auto report_throughput(char const * name, std::size_t bytes, Function function) -> void
+  {
+    auto checksum = std::size_t{};
+    auto seconds = best_of(function, checksum);
+    std::printf("%-40s %10.1f MB/s  (checksum %zu)\n", name, static_cast<double>(bytes) / seconds / 1e6, checksum);
+  }
+
+  template<typename Function>
+  auto report_time(char const * name, std::size_t operations, Function function) -> void
+  {
+    auto checksum = std::size_t{};
+    auto seconds = best_of(function, checksum);
+    std::printf("%-40s %10.2f ns/op  (checksum %zu)\n", name, seconds / static_cast<double>(operations) * 1e9, checksum);
+  }
+
+  inline auto report_size(char const * name, std::size_t bytes) -> void
+  {
+    std::printf("%-40s %10zu bytes\n", name, bytes);
+  }
+
+}  // namespace benchmark
+
+#endif
@@ -0,0 +1,87 @@
+#include "benchmark.hpp"
+#include "newtype/newtype.hpp"
+#include "newtype/read_all.hpp"
+#include "newtype/write_all.hpp"
+
+#include <cstddef>
+#include <cstdio>
+#include <iterator>
+#include <random>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace bulk_io_benchmark
+{
+
+  using count = nt::new_type<long, struct count_tag, deriving(nt::Read, nt::Show)>;
+
+  auto make_input(std::size_t size) -> std::string
+  {
+    auto engine = std::mt19937_64{42};
+    auto distribution = std::uniform_int_distribution<long>{-1'000'000'000, 1'000'000'000};
+    auto input = std::string{};
+    for (auto index = std::size_t{}; index < size; ++index)
+    {
+      input += std::to_string(distribution(engine));
+      input += '\n';
+    }
+    return input;
+  }
+
+  auto read_all(std::string_view input) -> std::size_t
+  {
+    auto values = std::vector<count>{};
+    nt::read_all<count>(input, std::back_inserter(values));
+    return values.size();
+  }
+
+  auto read_stream(std::string const & input) -> std::size_t
+  {
+    auto values = std::vector<count>{};
+    auto stream = std::istringstream{input};
+    auto value = count{};
+    while (stream >> value)
+    {
+      values.push_back(value);
+    }
+    return values.size();
+  }
+
+  auto write_all(std::vector<count> const & values) -> std::size_t
+  {
+    auto output = std::string{};
+    nt::write_all(values, output);
+    return output.size();
+  }
+
+  auto write_stream(std::vector<count> const & values) -> std::size_t
+  {
+    auto stream = std::ostringstream{};
+    auto separator = "";
+    for (auto const & value : values)
+    {
+      stream << separator << value;
+      separator = "\n";
+    }
+    return stream.view().size();
+  }
+
+}  // namespace bulk_io_benchmark
+
+auto main(int argc, char ** argv) -> int
+{
+  using namespace bulk_io_benchmark;
+
+  auto const size = benchmark::size_argument(argc, argv, 1'000'000);
+  auto const input = make_input(size);
+  std::printf("%zu values, %zu bytes, best of %d runs\n", size, input.size(), benchmark::repetitions);
+
+  benchmark::report_throughput("nt::read_all", input.size(), [&] { return read_all(input); });
+  benchmark::report_throughput("std::istream >>", input.size(), [&] { return read_stream(input); });
+
+  auto const values = nt::read_all<count>(input);
+  benchmark::report_throughput("nt::write_all", input.size(), [&] { return write_all(values); });
+  benchmark::report_throughput("std::ostream <<", input.size(), [&] { return write_stream(values); });
+}
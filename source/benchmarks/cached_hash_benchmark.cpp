@@ -0,0 +1,98 @@
+#include "benchmark.hpp"
+#include "newtype/hash.hpp"
+#include "newtype/newtype.hpp"
+
+#include <cstddef>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace cached_hash_benchmark
+{
+
+  using path = nt::new_type<std::string, struct path_tag, deriving(nt::Hash)>;
+  using cached_path = nt::new_type<std::string, struct cached_path_tag, deriving(nt::CachedHash)>;
+
+  auto constexpr distinct_keys = std::size_t{100'000};
+  auto constexpr key_prefix = "/srv/storage/volumes/primary/projects/archive/2024/quarterly/reports/generated/by/the/nightly/export/job/";
+
+  auto make_key(std::size_t index) -> std::string
+  {
+    return key_prefix + std::string(128, 'x') + std::to_string(index);
+  }
+
+  auto make_picks(std::size_t size) -> std::vector<std::size_t>
+  {
+    auto engine = std::mt19937_64{42};
+    auto distribution = std::uniform_int_distribution<std::size_t>{0, 2 * distinct_keys - 1};
+    auto picks = std::vector<std::size_t>(size);
+    for (auto & pick : picks)
+    {
+      pick = distribution(engine);
+    }
+    return picks;
+  }
+
+  template<typename KeyType>
+  auto insert(std::vector<KeyType> const & keys) -> std::size_t
+  {
+    auto map = std::unordered_map<KeyType, std::size_t>{};
+    for (auto index = std::size_t{}; index < distinct_keys; ++index)
+    {
+      map.emplace(keys[index], index);
+    }
+    return map.size();
+  }
+
+  template<typename KeyType>
+  auto lookup(std::unordered_map<KeyType, std::size_t> const & map, std::vector<KeyType> const & keys) -> std::size_t
+  {
+    auto hits = std::size_t{};
+    for (auto const & key : keys)
+    {
+      hits += map.contains(key);
+    }
+    return hits;
+  }
+
+}  // namespace cached_hash_benchmark
+
+auto main(int argc, char ** argv) -> int
+{
+  using namespace cached_hash_benchmark;
+
+  auto const size = benchmark::size_argument(argc, argv, 1'000'000);
+  auto const picks = make_picks(size);
+
+  auto paths = std::vector<path>{};
+  auto cached_paths = std::vector<cached_path>{};
+  for (auto index = std::size_t{}; index < 2 * distinct_keys; ++index)
+  {
+    paths.emplace_back(make_key(index));
+    cached_paths.emplace_back(make_key(index));
+  }
+
+  auto path_map = std::unordered_map<path, std::size_t>{};
+  auto cached_path_map = std::unordered_map<cached_path, std::size_t>{};
+  auto path_lookups = std::vector<path>{};
+  auto cached_path_lookups = std::vector<cached_path>{};
+  for (auto index = std::size_t{}; index < distinct_keys; ++index)
+  {
+    path_map.emplace(paths[index], index);
+    cached_path_map.emplace(cached_paths[index], index);
+  }
+  for (auto pick : picks)
+  {
+    path_lookups.push_back(paths[pick]);
+    cached_path_lookups.push_back(cached_paths[pick]);
+  }
+
+  std::printf("%zu lookups of %zu-byte keys, half of them misses, best of %d runs\n", size, make_key(0).size(), benchmark::repetitions);
+
+  benchmark::report_time("insert Hash", distinct_keys, [&] { return insert(paths); });
+  benchmark::report_time("insert CachedHash", distinct_keys, [&] { return insert(cached_paths); });
+  benchmark::report_time("lookup Hash", size, [&] { return lookup(path_map, path_lookups); });
+  benchmark::report_time("lookup CachedHash", size, [&] { return lookup(cached_path_map, cached_path_lookups); });
+}
@@ -0,0 +1,92 @@
+#include "newtype/indexed_vector.hpp"
+#include "newtype/newtype.hpp"
+
+#include <cstddef>
+#include <vector>
+
+namespace codegen_check
+{
+
+  using row = nt::new_type<std::size_t, struct row_tag, deriving(nt::Index, nt::Relational)>;
+  using meters = nt::new_type<long, struct meters_tag, deriving(nt::Arithmetic)>;
+
+}  // namespace codegen_check
+
+extern "C" auto baseline_index_loop(std::vector<long> const & values) -> long
+{
+  auto sum = 0l;
+  for (auto index = std::size_t{}; index < values.size(); ++index)
+  {
+    sum += values[index];
+  }
+  return sum;
+}
+
+extern "C" auto newtype_index_loop(nt::indexed_vector<codegen_check::row, long> const & values) -> long
+{
+  auto sum = 0l;
+  for (auto index = codegen_check::row{}; index < codegen_check::row{values.size()}; ++index)
+  {
+    sum += values[index];
+  }
+  return sum;
+}
+
+extern "C" auto baseline_index_range(std::vector<long> & values) -> void
+{
+  for (auto index = std::size_t{}, last = values.size(); index != last; ++index)
+  {
+    values[index] *= 2;
+  }
+}
+
+extern "C" auto newtype_index_range(nt::indexed_vector<codegen_check::row, long> & values) -> void
+{
+  for (auto index : nt::indices(codegen_check::row{}, codegen_check::row{values.size()}))
+  {
+    values[index] *= 2;
+  }
+}
+
+extern "C" auto baseline_arithmetic(long const * values, std::size_t count, long offset) -> long
+{
+  auto total = 0l;
+  for (auto index = std::size_t{}; index < count; ++index)
+  {
+    total = total + values[index] * 3 - offset;
+  }
+  return total;
+}
+
+extern "C" auto newtype_arithmetic(codegen_check::meters const * values, std::size_t count, codegen_check::meters offset)
+    -> codegen_check::meters
+{
+  auto total = codegen_check::meters{};
+  for (auto index = std::size_t{}; index < count; ++index)
+  {
+    total = total + values[index] * codegen_check::meters{3} - offset;
+  }
+  return total;
+}
+
+extern "C" auto baseline_index_step(std::size_t position, std::size_t steps) -> std::size_t
+{
+  while (steps-- != 0)
+  {
+    ++position;
+    ++position;
+    --position;
+  }
+  return position;
+}
+
+extern "C" auto newtype_index_step(codegen_check::row position, std::size_t steps) -> codegen_check::row
+{
+  while (steps-- != 0)
+  {
+    ++position;
+    ++position;
+    --position;
+  }
+  return position;
+}
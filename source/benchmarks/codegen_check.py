@@ -0,0 +1,107 @@
+# -*- coding: utf-8 -*-
+
+"""Code generation checks for the newtype library.
+
+Compile a translation unit to assembly and compare the instructions generated for every pair of functions named
+baseline_<name> and newtype_<name>. The check fails if the functions of a pair differ after local labels have been
+renamed consistently, or if a function has no counterpart.
+"""
+
+import argparse
+import difflib
+import re
+import subprocess
+import sys
+
+
+FUNCTION_LABEL = re.compile(r'^_?(baseline|newtype)_(\w+):')
+GLOBAL_LABEL = re.compile(r'^_?[A-Za-z]\w*:')
+LOCAL_LABEL = re.compile(r'(?<![\w.$])\.?L[\w$]+')
+FRAME_LABEL = re.compile(r'^\.?L(FB|FE|VL|func_begin|func_end)\d+:')
+
+
+def assembly(arguments):
+    command = [arguments.compiler, '-std=c++20', '-O2', '-S', '-o', '-', '-fno-asynchronous-unwind-tables']
+    if arguments.compiler_id == 'GNU':
+        command.append('-fno-ipa-icf')
+    command += [f'-I{directory}' for directory in arguments.include]
+    command.append(arguments.source)
+    process = subprocess.run(command, stdout=subprocess.PIPE, stderr=subprocess.PIPE, text=True)
+    if process.returncode != 0:
+        sys.stderr.write(process.stderr)
+        return None
+    return process.stdout
+
+
+def functions(listing):
+    found = {}
+    current = None
+    for line in listing.splitlines():
+        line = line.split('#', 1)[0].rstrip()
+        match = FUNCTION_LABEL.match(line)
+        if match:
+            current = found.setdefault(match.group(1), {}).setdefault(match.group(2), [])
+            continue
+        if current is None or not line:
+            continue
+        if GLOBAL_LABEL.match(line) or re.match(r'^\s*\.(size|cfi_endproc)\b', line):
+            current = None
+            continue
+        if re.match(r'^\s*\.', line) or FRAME_LABEL.match(line):
+            continue
+        current.append(line.strip())
+    return found
+
+
+def normalize(instructions):
+    names = {}
+
+    def rename(match):
+        return names.setdefault(match.group(0), f'.L{len(names)}')
+
+    return [LOCAL_LABEL.sub(rename, instruction) for instruction in instructions]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--compiler', required=True)
+    parser.add_argument('--compiler-id', default='')
+    parser.add_argument('--include', action='append', default=[])
+    parser.add_argument('source')
+    arguments = parser.parse_args()
+
+    listing = assembly(arguments)
+    if listing is None:
+        return 1
+
+    found = functions(listing)
+    baselines = found.get('baseline', {})
+    candidates = found.get('newtype', {})
+
+    failed = False
+    for name in sorted(set(baselines) | set(candidates)):
+        if name not in baselines or name not in candidates:
+            print(f'{name}: missing baseline_{name} or newtype_{name}')
+            failed = True
+            continue
+
+        expected = normalize(baselines[name])
+        actual = normalize(candidates[name])
+        if expected == actual:
+            print(f'{name}: identical ({len(expected)} instructions)')
+            continue
+
+        failed = True
+        print(f'{name}: differs')
+        for line in difflib.unified_diff(expected, actual, f'baseline_{name}', f'newtype_{name}', lineterm=''):
+            print(f'  {line}')
+
+    if not baselines:
+        print('no functions to compare')
+        failed = True
+
+    return 1 if failed else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,289 @@
+# -*- coding: utf-8 -*-
+
+"""Compile-time benchmarks for the newtype library.
+
+generate
+    Write a translation unit containing a given number of distinct nt::new_type instantiations, either including the
+    library headers or importing the module 'newtype'.
+measure
+    Run a compiler command, used as a CMake compiler launcher, and record its wall time, peak memory, and template
+    instantiation statistics.
+summarize
+    Print a table of all recorded measurements, followed by a comparison of clean header and module builds.
+"""
+
+import argparse
+import json
+import os
+import re
+import subprocess
+import sys
+import time
+
+try:
+    import resource
+except ImportError:
+    resource = None
+
+
+BASE_TYPES = [
+    'int',
+    'long',
+    'unsigned int',
+    'double',
+    'std::string',
+    'std::vector<int>',
+]
+
+FEATURES = [
+    'nt::Arithmetic',
+    'nt::EqBase',
+    'nt::Hash',
+    'nt::Iterable',
+    'nt::Read',
+    'nt::Relational',
+    'nt::Show',
+]
+
+HEADER_PROLOGUE = '''\
+#include "newtype/newtype.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <vector>
+'''
+
+MODULE_PROLOGUE = '''\
+#include <cstddef>
+#include <functional>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+import newtype;
+'''
+
+PROLOGUE = '''\
+
+namespace compile_benchmark
+{
+
+  template<typename NewType>
+  auto exercise(NewType const & lhs, NewType const & rhs, std::istream & input, std::ostream & output) -> std::size_t
+  {
+    auto result = static_cast<std::size_t>(lhs == rhs);
+    if constexpr (requires { lhs < rhs; })
+    {
+      result += (lhs < rhs) + (lhs >= rhs);
+    }
+    if constexpr (requires { lhs + rhs; })
+    {
+      result += static_cast<std::size_t>(((lhs + rhs) == lhs));
+    }
+    if constexpr (requires { std::hash<NewType>{}(lhs); })
+    {
+      result += std::hash<NewType>{}(lhs);
+    }
+    if constexpr (requires { output << lhs; })
+    {
+      output << lhs;
+    }
+    if constexpr (requires(NewType target) { input >> target; })
+    {
+      auto target = lhs;
+      input >> target;
+    }
+    if constexpr (requires { begin(lhs); })
+    {
+      result += static_cast<std::size_t>(begin(lhs) == end(lhs));
+    }
+    return result;
+  }
+
+'''
+
+
+def derivation_clause(index):
+    mask = (index * 53) % (1 << len(FEATURES))
+    return ', '.join(feature for bit, feature in enumerate(FEATURES) if mask & (1 << bit))
+
+
+def generate(arguments):
+    lines = [MODULE_PROLOGUE if arguments.use_module else HEADER_PROLOGUE, PROLOGUE]
+    for index in range(arguments.count):
+        base_type = BASE_TYPES[index % len(BASE_TYPES)]
+        lines.append(f'  using type_{index} = nt::new_type<{base_type}, struct tag_{index}, nt::deriving({derivation_clause(index)})>;\n')
+    lines.append('\n  auto exercise_all(std::istream & input, std::ostream & output) -> std::size_t\n')
+    lines.append('  {\n')
+    lines.append('    auto result = std::size_t{};\n')
+    for index in range(arguments.count):
+        lines.append(f'    result += exercise(type_{index}{{}}, type_{index}{{}}, input, output);\n')
+    lines.append('    return result;\n')
+    lines.append('  }\n')
+    lines.append('\n}  // namespace compile_benchmark\n')
+
+    content = ''.join(lines)
+    try:
+        with open(arguments.output, encoding='utf-8') as existing:
+            if existing.read() == content:
+                return 0
+    except FileNotFoundError:
+        pass
+    with open(arguments.output, 'w', encoding='utf-8') as output:
+        output.write(content)
+    return 0
+
+
+def object_file(command):
+    for index, argument in enumerate(command[:-1]):
+        if argument == '-o':
+            return command[index + 1]
+    return None
+
+
+def clang_instantiations(command):
+    output = object_file(command)
+    if not output:
+        return None
+    trace = os.path.splitext(output)[0] + '.json'
+    try:
+        with open(trace, encoding='utf-8') as file:
+            events = json.load(file)['traceEvents']
+    except (FileNotFoundError, KeyError, ValueError):
+        return None
+    return sum(1 for event in events if event.get('name') in ('InstantiateClass', 'InstantiateFunction'))
+
+
+def gcc_instantiation_seconds(report):
+    match = re.search(r'^\s*template instantiation\s*:(.*)$', report, re.MULTILINE)
+    if not match:
+        return None
+    columns = re.findall(r'([0-9.]+)[kMG]?\s*\(', match.group(1))
+    return float(columns[2]) if len(columns) == 4 else None
+
+
+def measure(arguments):
+    command = arguments.command[1:] if arguments.command[:1] == ['--'] else arguments.command
+
+    if '-E' in command:
+        return subprocess.run(command).returncode
+
+    start = time.perf_counter()
+    process = subprocess.run(command, stderr=subprocess.PIPE, text=True)
+    wall_seconds = time.perf_counter() - start
+
+    if process.returncode != 0:
+        sys.stderr.write(process.stderr)
+        return process.returncode
+
+    peak_kib = None
+    if resource:
+        peak = resource.getrusage(resource.RUSAGE_CHILDREN).ru_maxrss
+        peak_kib = peak // 1024 if sys.platform == 'darwin' else peak
+
+    with open(arguments.record + '.stderr.txt', 'w', encoding='utf-8') as file:
+        file.write(process.stderr)
+
+    record = {
+        'name': arguments.name,
+        'compiler': arguments.compiler or os.path.basename(command[0]),
+        'wall_seconds': round(wall_seconds, 3),
+        'peak_memory_kib': peak_kib,
+        'clang_instantiations': clang_instantiations(command),
+        'gcc_instantiation_seconds': gcc_instantiation_seconds(process.stderr),
+    }
+    with open(arguments.record, 'w', encoding='utf-8') as file:
+        json.dump(record, file, indent=2)
+    return 0
+
+
+def summarize(arguments):
+    header = ('benchmark', 'compiler', 'wall [s]', 'peak [MiB]', 'instantiations', 'instantiation [s]')
+    rows = []
+    for path in arguments.records:
+        try:
+            with open(path, encoding='utf-8') as file:
+                record = json.load(file)
+        except FileNotFoundError:
+            continue
+
+        def show(value, format='{}'):
+            return '-' if value is None else format.format(value)
+
+        rows.append((
+            record['name'],
+            record['compiler'],
+            show(record['wall_seconds'], '{:.2f}'),
+            show(None if record['peak_memory_kib'] is None else record['peak_memory_kib'] / 1024, '{:.1f}'),
+            show(record['clang_instantiations']),
+            show(record['gcc_instantiation_seconds'], '{:.2f}'),
+        ))
+
+    widths = [max(len(row[column]) for row in [header] + rows) for column in range(len(header))]
+    for row in [header] + rows:
+        print('  '.join(cell.ljust(width) for cell, width in zip(row, widths)).rstrip())
+
+    if arguments.module_interface:
+        summarize_modules(arguments, {row[0]: row for row in rows})
+    return 0
+
+
+def summarize_modules(arguments, rows):
+    interface = rows.get(arguments.module_interface)
+    if not interface or interface[2] == '-':
+        return
+
+    header = ('benchmark', 'header [s]', 'module [s]', 'interface [s]', 'import [s]')
+    comparisons = []
+    for name, row in rows.items():
+        imported = rows.get(name + '_module')
+        if not imported:
+            continue
+        comparisons.append((
+            name,
+            row[2],
+            '{:.2f}'.format(float(interface[2]) + float(imported[2])),
+            interface[2],
+            imported[2],
+        ))
+    if not comparisons:
+        return
+
+    print()
+    widths = [max(len(row[column]) for row in [header] + comparisons) for column in range(len(header))]
+    for row in [header] + comparisons:
+        print('  '.join(cell.ljust(width) for cell, width in zip(row, widths)).rstrip())
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    commands = parser.add_subparsers(dest='subcommand', required=True)
+
+    generate_parser = commands.add_parser('generate')
+    generate_parser.add_argument('--count', type=int, required=True)
+    generate_parser.add_argument('--output', required=True)
+    generate_parser.add_argument('--module', dest='use_module', action='store_true')
+    generate_parser.set_defaults(function=generate)
+
+    measure_parser = commands.add_parser('measure')
+    measure_parser.add_argument('--name', required=True)
+    measure_parser.add_argument('--compiler')
+    measure_parser.add_argument('--record', required=True)
+    measure_parser.add_argument('command', nargs=argparse.REMAINDER)
+    measure_parser.set_defaults(function=measure)
+
+    summarize_parser = commands.add_parser('summarize')
+    summarize_parser.add_argument('--module-interface')
+    summarize_parser.add_argument('records', nargs='*')
+    summarize_parser.set_defaults(function=summarize)
+
+    arguments = parser.parse_args()
+    return arguments.function(arguments)
+
+
+if __name__ == '__main__':
+    sys.exit(main())
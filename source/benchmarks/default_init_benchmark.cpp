@@ -0,0 +1,67 @@
+#include "benchmark.hpp"
+#include "newtype/default_init_allocator.hpp"
+#include "newtype/newtype.hpp"
+
+#include <cstddef>
+#include <cstdio>
+#include <vector>
+
+namespace default_init_benchmark
+{
+
+  using sample = nt::new_type<double, struct sample_tag>;
+  using raw_sample = nt::new_type<double, struct raw_sample_tag, deriving(nt::DefaultInit)>;
+
+  using samples = std::vector<sample>;
+  using raw_samples = std::vector<raw_sample, nt::default_init_allocator<raw_sample>>;
+
+  template<typename BufferType>
+  auto allocate(std::size_t size) -> std::size_t
+  {
+    auto buffer = BufferType(size);
+    benchmark::do_not_optimize(buffer.data());
+    return buffer.size();
+  }
+
+  template<typename BufferType>
+  auto allocate_and_fill(std::size_t size) -> std::size_t
+  {
+    auto buffer = BufferType(size);
+    for (auto index = std::size_t{}; index < size; ++index)
+    {
+      buffer[index] = typename BufferType::value_type{static_cast<double>(index)};
+    }
+    benchmark::do_not_optimize(buffer.data());
+    return buffer.size();
+  }
+
+  template<typename BufferType>
+  auto resize(BufferType & buffer, std::size_t size) -> std::size_t
+  {
+    buffer.clear();
+    buffer.resize(size);
+    benchmark::do_not_optimize(buffer.data());
+    return buffer.size();
+  }
+
+}  // namespace default_init_benchmark
+
+auto main(int argc, char ** argv) -> int
+{
+  using namespace default_init_benchmark;
+
+  auto const size = benchmark::size_argument(argc, argv, 10'000'000);
+  std::printf("%zu doubles, best of %d runs\n", size, benchmark::repetitions);
+
+  benchmark::report_time("allocate new_type<double>", size, [&] { return allocate<samples>(size); });
+  benchmark::report_time("allocate DefaultInit", size, [&] { return allocate<raw_samples>(size); });
+  benchmark::report_time("allocate and fill new_type<double>", size, [&] { return allocate_and_fill<samples>(size); });
+  benchmark::report_time("allocate and fill DefaultInit", size, [&] { return allocate_and_fill<raw_samples>(size); });
+
+  auto buffer = samples{};
+  buffer.reserve(size);
+  auto raw_buffer = raw_samples{};
+  raw_buffer.reserve(size);
+  benchmark::report_time("resize reserved new_type<double>", size, [&] { return resize(buffer, size); });
+  benchmark::report_time("resize reserved DefaultInit", size, [&] { return resize(raw_buffer, size); });
+}
@@ -0,0 +1,115 @@
+#include "benchmark.hpp"
+#include "newtype/newtype.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdio>
+#include <map>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace emplace_benchmark
+{
+
+  struct matrix
+  {
+    matrix(std::size_t rows, std::size_t columns)
+        : rows{rows}
+        , columns{columns}
+    {
+      cells.fill(static_cast<double>(rows * columns));
+    }
+
+    std::size_t rows;
+    std::size_t columns;
+    std::array<double, 64> cells;
+  };
+
+  using user_name = nt::new_type<std::string, struct user_name_tag, deriving(nt::Relational)>;
+  using weights = nt::new_type<matrix, struct weights_tag>;
+
+  auto constexpr long_name = "a user name that is too long for the small string optimization";
+
+  auto names_by_move(std::size_t size) -> std::size_t
+  {
+    auto names = std::vector<user_name>{};
+    names.reserve(size);
+    for (auto index = std::size_t{}; index < size; ++index)
+    {
+      names.push_back(user_name{std::string{long_name}});
+    }
+    return names.size();
+  }
+
+  auto names_in_place(std::size_t size) -> std::size_t
+  {
+    auto names = std::vector<user_name>{};
+    names.reserve(size);
+    for (auto index = std::size_t{}; index < size; ++index)
+    {
+      names.emplace_back(std::in_place, long_name);
+    }
+    return names.size();
+  }
+
+  auto weights_by_move(std::size_t size) -> std::size_t
+  {
+    auto values = std::vector<weights>{};
+    values.reserve(size);
+    for (auto index = std::size_t{}; index < size; ++index)
+    {
+      values.push_back(weights{matrix{index, 8}});
+    }
+    return values.size();
+  }
+
+  auto weights_in_place(std::size_t size) -> std::size_t
+  {
+    auto values = std::vector<weights>{};
+    values.reserve(size);
+    for (auto index = std::size_t{}; index < size; ++index)
+    {
+      values.emplace_back(std::in_place, index, std::size_t{8});
+    }
+    return values.size();
+  }
+
+  auto map_by_move(std::size_t size) -> std::size_t
+  {
+    auto values = std::map<std::size_t, weights>{};
+    for (auto index = std::size_t{}; index < size; ++index)
+    {
+      values.emplace(index, weights{matrix{index, 8}});
+    }
+    return values.size();
+  }
+
+  auto map_in_place(std::size_t size) -> std::size_t
+  {
+    auto values = std::map<std::size_t, weights>{};
+    for (auto index = std::size_t{}; index < size; ++index)
+    {
+      values.emplace(std::piecewise_construct, std::forward_as_tuple(index), std::forward_as_tuple(std::in_place, index, std::size_t{8}));
+    }
+    return values.size();
+  }
+
+}  // namespace emplace_benchmark
+
+auto main(int argc, char ** argv) -> int
+{
+  using namespace emplace_benchmark;
+
+  auto const size = benchmark::size_argument(argc, argv, 1'000'000);
+
+  std::printf("%zu insertions, best of %d runs\n", size, benchmark::repetitions);
+
+  benchmark::report_time("vector<user_name> push_back(move)", size, [&] { return names_by_move(size); });
+  benchmark::report_time("vector<user_name> emplace_back", size, [&] { return names_in_place(size); });
+  benchmark::report_time("vector<weights> push_back(move)", size, [&] { return weights_by_move(size); });
+  benchmark::report_time("vector<weights> emplace_back", size, [&] { return weights_in_place(size); });
+  benchmark::report_time("map<size_t, weights> emplace(move)", size, [&] { return map_by_move(size); });
+  benchmark::report_time("map<size_t, weights> emplace(in_place)", size, [&] { return map_in_place(size); });
+}
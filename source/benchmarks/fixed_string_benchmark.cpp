@@ -0,0 +1,90 @@
+#include "benchmark.hpp"
+#include "newtype/fixed_string.hpp"
+#include "newtype/newtype.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace fixed_string_benchmark
+{
+
+  using ticker = nt::new_type<std::string, struct ticker_tag, deriving(nt::Relational)>;
+  using fixed_ticker = nt::new_type<nt::fixed_string<7>, struct fixed_ticker_tag, deriving(nt::Relational)>;
+
+  auto constexpr distinct_tickers = std::size_t{10'000};
+
+  auto make_names(std::size_t size) -> std::vector<std::string>
+  {
+    auto engine = std::mt19937_64{42};
+    auto length = std::uniform_int_distribution<std::size_t>{3, 7};
+    auto letter = std::uniform_int_distribution<int>{'A', 'Z'};
+    auto names = std::vector<std::string>(size);
+    for (auto & name : names)
+    {
+      name.resize(length(engine));
+      std::ranges::generate(name, [&] { return static_cast<char>(letter(engine)); });
+    }
+    return names;
+  }
+
+  template<typename KeyType>
+  auto lookup(std::map<KeyType, std::size_t> const & map, std::vector<KeyType> const & keys) -> std::size_t
+  {
+    auto hits = std::size_t{};
+    for (auto const & key : keys)
+    {
+      hits += map.contains(key);
+    }
+    return hits;
+  }
+
+  template<typename KeyType>
+  auto sort(std::vector<KeyType> const & keys) -> std::size_t
+  {
+    auto sorted = keys;
+    std::ranges::sort(sorted);
+    benchmark::do_not_optimize(sorted.data());
+    return sorted.size();
+  }
+
+}  // namespace fixed_string_benchmark
+
+auto main(int argc, char ** argv) -> int
+{
+  using namespace fixed_string_benchmark;
+
+  auto const size = benchmark::size_argument(argc, argv, 1'000'000);
+  auto const known = make_names(distinct_tickers);
+  auto const names = make_names(size);
+
+  auto ticker_map = std::map<ticker, std::size_t>{};
+  auto fixed_ticker_map = std::map<fixed_ticker, std::size_t>{};
+  for (auto index = std::size_t{}; index < known.size(); ++index)
+  {
+    ticker_map.emplace(ticker{known[index]}, index);
+    fixed_ticker_map.emplace(fixed_ticker{nt::fixed_string<7>{known[index]}}, index);
+  }
+
+  auto tickers = std::vector<ticker>{};
+  auto fixed_tickers = std::vector<fixed_ticker>{};
+  for (auto index = std::size_t{}; index < size; ++index)
+  {
+    auto const & name = index % 2 ? known[index % known.size()] : names[index];
+    tickers.push_back(ticker{name});
+    fixed_tickers.push_back(fixed_ticker{nt::fixed_string<7>{name}});
+  }
+
+  std::printf("%zu tickers of 3 to 7 characters, best of %d runs\n", size, benchmark::repetitions);
+
+  benchmark::report_size("new_type<std::string>", sizeof(ticker));
+  benchmark::report_size("new_type<fixed_string<7>>", sizeof(fixed_ticker));
+  benchmark::report_time("map lookup std::string", size, [&] { return lookup(ticker_map, tickers); });
+  benchmark::report_time("map lookup fixed_string<7>", size, [&] { return lookup(fixed_ticker_map, fixed_tickers); });
+  benchmark::report_time("sort std::string", size, [&] { return sort(tickers); });
+  benchmark::report_time("sort fixed_string<7>", size, [&] { return sort(fixed_tickers); });
+}
@@ -0,0 +1,110 @@
+#include "benchmark.hpp"
+#include "newtype/hash.hpp"
+#include "newtype/interned.hpp"
+#include "newtype/newtype.hpp"
+
+#include <cstddef>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace interned_benchmark
+{
+
+  using symbol = nt::new_type<std::string, struct symbol_tag, deriving(nt::Hash, nt::Relational)>;
+  using interned_symbol = nt::interned<struct interned_symbol_tag>;
+
+  auto constexpr distinct_symbols = std::size_t{10'000};
+
+  auto make_names() -> std::vector<std::string>
+  {
+    auto names = std::vector<std::string>{};
+    for (auto index = std::size_t{}; index < distinct_symbols; ++index)
+    {
+      names.push_back("instrument.exchange.segment." + std::to_string(index * 7919));
+    }
+    return names;
+  }
+
+  auto make_picks(std::size_t size) -> std::vector<std::size_t>
+  {
+    auto engine = std::mt19937_64{42};
+    auto distribution = std::uniform_int_distribution<std::size_t>{0, distinct_symbols - 1};
+    auto picks = std::vector<std::size_t>(size);
+    for (auto & pick : picks)
+    {
+      pick = distribution(engine);
+    }
+    return picks;
+  }
+
+  auto heap_bytes(std::string const & value) -> std::size_t
+  {
+    return value.capacity() > std::string{}.capacity() ? value.capacity() + 1 : 0;
+  }
+
+  template<typename KeyType>
+  auto lookup(std::unordered_map<KeyType, std::size_t> const & map, std::vector<KeyType> const & keys) -> std::size_t
+  {
+    auto sum = std::size_t{};
+    for (auto const & key : keys)
+    {
+      sum += map.find(key)->second;
+    }
+    return sum;
+  }
+
+}  // namespace interned_benchmark
+
+auto main(int argc, char ** argv) -> int
+{
+  using namespace interned_benchmark;
+
+  auto const size = benchmark::size_argument(argc, argv, 1'000'000);
+  auto const names = make_names();
+  auto const picks = make_picks(size);
+
+  auto symbols = std::vector<symbol>{};
+  auto interned_symbols = std::vector<interned_symbol>{};
+  auto symbol_map = std::unordered_map<symbol, std::size_t>{};
+  auto interned_map = std::unordered_map<interned_symbol, std::size_t>{};
+  for (auto index = std::size_t{}; index < names.size(); ++index)
+  {
+    symbol_map.emplace(symbol{names[index]}, index);
+    interned_map.emplace(interned_symbol{names[index]}, index);
+  }
+  for (auto pick : picks)
+  {
+    symbols.push_back(symbol{names[pick]});
+    interned_symbols.push_back(interned_symbol{names[pick]});
+  }
+
+  std::printf("%zu keys over %zu distinct symbols, best of %d runs\n", size, distinct_symbols, benchmark::repetitions);
+
+  auto symbol_bytes = symbols.size() * sizeof(symbol);
+  for (auto const & value : symbols)
+  {
+    symbol_bytes += heap_bytes(value.decay());
+  }
+  auto pool_bytes = std::size_t{};
+  for (auto const & name : names)
+  {
+    pool_bytes += heap_bytes(name) + sizeof(std::string) + sizeof(std::size_t);
+  }
+  benchmark::report_size("new_type<std::string> keys", symbol_bytes);
+  benchmark::report_size("nt::interned keys", interned_symbols.size() * sizeof(interned_symbol));
+  benchmark::report_size("nt::interned pool (excluding buckets)", pool_bytes);
+
+  benchmark::report_time("intern existing string", size, [&] {
+    auto sum = std::size_t{};
+    for (auto pick : picks)
+    {
+      sum += interned_symbol{names[pick]}.size();
+    }
+    return sum;
+  });
+  benchmark::report_time("lookup new_type<std::string> + Hash", size, [&] { return lookup(symbol_map, symbols); });
+  benchmark::report_time("lookup nt::interned", size, [&] { return lookup(interned_map, interned_symbols); });
+}
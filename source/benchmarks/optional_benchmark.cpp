@@ -0,0 +1,74 @@
+#include "benchmark.hpp"
+#include "newtype/newtype.hpp"
+#include "newtype/optional.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <optional>
+#include <random>
+#include <vector>
+
+namespace optional_benchmark
+{
+
+  using order_id = nt::new_type<std::uint32_t, struct order_id_tag, deriving(nt::Sentinel<0u>)>;
+  using price = nt::new_type<double, struct price_tag, deriving(nt::Sentinel<std::numeric_limits<double>::quiet_NaN()>)>;
+
+  template<typename OptionalType>
+  auto make_column(std::size_t size) -> std::vector<OptionalType>
+  {
+    using value_type = typename OptionalType::value_type;
+    using base_type = typename value_type::base_type;
+
+    auto engine = std::mt19937_64{42};
+    auto column = std::vector<OptionalType>(size);
+    for (auto & entry : column)
+    {
+      if (auto random = engine(); random % 4 != 0)
+      {
+        entry = value_type{static_cast<base_type>(random % 1'000'000 + 1)};
+      }
+    }
+    return column;
+  }
+
+  template<typename OptionalType>
+  auto scan(std::vector<OptionalType> const & column) -> std::size_t
+  {
+    auto total = std::size_t{};
+    for (auto const & entry : column)
+    {
+      if (entry.has_value())
+      {
+        total += static_cast<std::size_t>(entry->decay());
+      }
+    }
+    return total;
+  }
+
+}  // namespace optional_benchmark
+
+auto main(int argc, char ** argv) -> int
+{
+  using namespace optional_benchmark;
+
+  auto const size = benchmark::size_argument(argc, argv, 10'000'000);
+  auto const ids = make_column<std::optional<order_id>>(size);
+  auto const sentinel_ids = make_column<nt::optional<order_id>>(size);
+  auto const prices = make_column<std::optional<price>>(size);
+  auto const sentinel_prices = make_column<nt::optional<price>>(size);
+
+  std::printf("%zu entries, one in four empty, best of %d runs\n", size, benchmark::repetitions);
+
+  benchmark::report_size("std::optional<order_id>", sizeof(std::optional<order_id>));
+  benchmark::report_size("nt::optional<order_id>", sizeof(nt::optional<order_id>));
+  benchmark::report_size("std::optional<price>", sizeof(std::optional<price>));
+  benchmark::report_size("nt::optional<price>", sizeof(nt::optional<price>));
+
+  benchmark::report_time("scan std::optional<order_id>", size, [&] { return scan(ids); });
+  benchmark::report_time("scan nt::optional<order_id>", size, [&] { return scan(sentinel_ids); });
+  benchmark::report_time("scan std::optional<price>", size, [&] { return scan(prices); });
+  benchmark::report_time("scan nt::optional<price>", size, [&] { return scan(sentinel_prices); });
+}
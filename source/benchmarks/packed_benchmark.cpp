@@ -0,0 +1,133 @@
+#include "benchmark.hpp"
+#include "newtype/newtype.hpp"
+#include "newtype/packed.hpp"
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+namespace packed_benchmark
+{
+
+  using sequence = nt::new_type<std::uint64_t, struct sequence_tag>;
+  using price = nt::new_type<std::int32_t, struct price_tag>;
+  using quantity = nt::new_type<std::uint32_t, struct quantity_tag>;
+
+  template<template<typename> typename PackedType>
+  struct wire_order
+  {
+    PackedType<sequence> sequence_number;
+    PackedType<price> limit;
+    PackedType<quantity> size;
+  };
+
+  struct raw_order
+  {
+    std::uint64_t sequence_number;
+    std::int32_t limit;
+    std::uint32_t size;
+  };
+
+  static_assert(sizeof(wire_order<nt::packed_be>) == 16);
+  static_assert(sizeof(raw_order) == 16);
+
+  template<typename ValueType>
+  auto from_big_endian(ValueType value) -> ValueType
+  {
+    using unsigned_type = std::make_unsigned_t<ValueType>;
+
+    if constexpr (std::endian::native == std::endian::big)
+    {
+      return value;
+    }
+#if defined(__GNUC__)
+    else if constexpr (sizeof(ValueType) == 8)
+    {
+      return static_cast<ValueType>(__builtin_bswap64(static_cast<unsigned_type>(value)));
+    }
+    else
+    {
+      return static_cast<ValueType>(__builtin_bswap32(static_cast<unsigned_type>(value)));
+    }
+#else
+    else
+    {
+      auto bytes = static_cast<unsigned_type>(value);
+      auto swapped = unsigned_type{};
+      for (auto index = std::size_t{}; index < sizeof(ValueType); ++index, bytes >>= 8)
+      {
+        swapped = static_cast<unsigned_type>(swapped << 8 | (bytes & 0xff));
+      }
+      return static_cast<ValueType>(swapped);
+    }
+#endif
+  }
+
+  auto make_input(std::size_t size) -> std::vector<wire_order<nt::packed_be>>
+  {
+    auto engine = std::mt19937_64{42};
+    auto orders = std::vector<wire_order<nt::packed_be>>(size);
+    for (auto index = std::size_t{}; index < size; ++index)
+    {
+      orders[index].sequence_number = sequence{index};
+      orders[index].limit = price{static_cast<std::int32_t>(engine() % 100'000)};
+      orders[index].size = quantity{static_cast<std::uint32_t>(engine() % 10'000)};
+    }
+    return orders;
+  }
+
+  template<template<typename> typename PackedType>
+  auto decode(std::vector<wire_order<PackedType>> const & orders) -> std::size_t
+  {
+    auto notional = std::size_t{};
+    for (auto const & order : orders)
+    {
+      auto limit = order.limit.load();
+      auto size = order.size.load();
+      notional += order.sequence_number.load().decay() ^ static_cast<std::size_t>(limit.decay()) * size.decay();
+    }
+    return notional;
+  }
+
+  auto decode_memcpy(std::vector<wire_order<nt::packed_be>> const & orders) -> std::size_t
+  {
+    auto notional = std::size_t{};
+    for (auto const & order : orders)
+    {
+      auto raw = raw_order{};
+      std::memcpy(&raw, &order, sizeof(raw));
+      auto limit = price{from_big_endian(raw.limit)};
+      auto size = quantity{from_big_endian(raw.size)};
+      notional += from_big_endian(raw.sequence_number) ^ static_cast<std::size_t>(limit.decay()) * size.decay();
+    }
+    return notional;
+  }
+
+}  // namespace packed_benchmark
+
+auto main(int argc, char ** argv) -> int
+{
+  using namespace packed_benchmark;
+
+  auto const size = benchmark::size_argument(argc, argv, 10'000'000);
+  auto const big_endian = make_input(size);
+  auto little_endian = std::vector<wire_order<nt::packed_le>>(size);
+  for (auto index = std::size_t{}; index < size; ++index)
+  {
+    little_endian[index].sequence_number = big_endian[index].sequence_number.load();
+    little_endian[index].limit = big_endian[index].limit.load();
+    little_endian[index].size = big_endian[index].size.load();
+  }
+  auto const bytes = size * sizeof(raw_order);
+
+  std::printf("%zu orders of %zu bytes, best of %d runs\n", size, sizeof(raw_order), benchmark::repetitions);
+
+  benchmark::report_throughput("memcpy and byte swap", bytes, [&] { return decode_memcpy(big_endian); });
+  benchmark::report_throughput("nt::packed_be", bytes, [&] { return decode(big_endian); });
+  benchmark::report_throughput("nt::packed_le", bytes, [&] { return decode(little_endian); });
+}
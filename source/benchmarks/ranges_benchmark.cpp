@@ -0,0 +1,65 @@
+#include "benchmark.hpp"
+#include "newtype/iterable.hpp"
+#include "newtype/newtype.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <ranges>
+#include <vector>
+
+namespace ranges_benchmark
+{
+
+  using samples = nt::new_type<std::vector<int>, struct samples_tag, deriving(nt::Iterable)>;
+
+  auto constexpr distance_calls = std::size_t{1'000'000};
+
+  template<typename RangeType>
+  auto copy(RangeType & source, std::vector<int> & target) -> std::size_t
+  {
+    std::ranges::copy(source, target.begin());
+    benchmark::do_not_optimize(target.data());
+    return static_cast<std::size_t>(target.back());
+  }
+
+  template<typename RangeType>
+  auto distance(RangeType & source, std::size_t calls) -> std::size_t
+  {
+    auto total = std::size_t{};
+    for (auto call = std::size_t{}; call < calls; ++call)
+    {
+      benchmark::do_not_optimize(source);
+      total += static_cast<std::size_t>(std::ranges::distance(source));
+    }
+    return total;
+  }
+
+}  // namespace ranges_benchmark
+
+auto main(int argc, char ** argv) -> int
+{
+  using namespace ranges_benchmark;
+
+  auto const size = benchmark::size_argument(argc, argv, 10'000'000);
+  auto plain = std::vector<int>(size);
+  std::iota(plain.begin(), plain.end(), 0);
+  auto strong = samples{plain};
+  auto element_wise = strong | std::views::transform(std::identity{});
+  auto unsized = strong | std::views::filter([](int value) { return value >= 0; });
+  auto target = std::vector<int>(size);
+  auto const bytes = size * sizeof(int);
+
+  std::printf("%zu ints, best of %d runs\n", size, benchmark::repetitions);
+
+  benchmark::report_throughput("ranges::copy std::vector", bytes, [&] { return copy(plain, target); });
+  benchmark::report_throughput("ranges::copy new_type (Iterable)", bytes, [&] { return copy(strong, target); });
+  benchmark::report_throughput("ranges::copy element-wise view", bytes, [&] { return copy(element_wise, target); });
+
+  benchmark::report_time("ranges::distance std::vector", distance_calls, [&] { return distance(plain, distance_calls); });
+  benchmark::report_time("ranges::distance new_type (Iterable)", distance_calls, [&] { return distance(strong, distance_calls); });
+  benchmark::report_time("ranges::distance unsized view", 1, [&] { return distance(unsized, 1); });
+}
@@ -0,0 +1,83 @@
+#include "benchmark.hpp"
+#include "newtype/fixed_string.hpp"
+#include "newtype/newtype.hpp"
+#include "newtype/read_columns.hpp"
+
+#include <cstddef>
+#include <cstdio>
+#include <random>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+namespace read_columns_benchmark
+{
+
+  using ticker = nt::new_type<nt::fixed_string<7>, struct ticker_tag, deriving(nt::Read)>;
+  using price = nt::new_type<double, struct price_tag, deriving(nt::Read)>;
+  using volume = nt::new_type<long, struct volume_tag, deriving(nt::Read)>;
+
+  auto make_input(std::size_t rows) -> std::string
+  {
+    auto engine = std::mt19937_64{42};
+    auto letter = std::uniform_int_distribution<int>{'A', 'Z'};
+    auto cents = std::uniform_int_distribution<long>{100, 1'000'000};
+    auto shares = std::uniform_int_distribution<long>{1, 10'000'000};
+    auto input = std::string{};
+    for (auto row = std::size_t{}; row < rows; ++row)
+    {
+      for (auto character = 0; character < 4; ++character)
+      {
+        input += static_cast<char>(letter(engine));
+      }
+      auto value = cents(engine);
+      input += ',' + std::to_string(value / 100) + (value % 100 < 10 ? ".0" : ".") + std::to_string(value % 100);
+      input += ',' + std::to_string(shares(engine)) + '\n';
+    }
+    return input;
+  }
+
+  auto read_columns(std::string_view input) -> std::size_t
+  {
+    auto columns = std::tuple<std::vector<ticker>, std::vector<price>, std::vector<volume>>{};
+    nt::read_columns(input, columns);
+    return std::get<0>(columns).size();
+  }
+
+  auto read_stream(std::string const & input) -> std::size_t
+  {
+    auto columns = std::tuple<std::vector<ticker>, std::vector<price>, std::vector<volume>>{};
+    auto stream = std::istringstream{input};
+    auto line = std::string{};
+    auto field = std::string{};
+    while (std::getline(stream, line))
+    {
+      auto row = std::istringstream{line};
+      auto price_value = price{};
+      auto volume_value = volume{};
+      std::getline(row, field, ',');
+      row >> price_value;
+      row.ignore();
+      row >> volume_value;
+      std::get<0>(columns).push_back(ticker{nt::fixed_string<7>{field}});
+      std::get<1>(columns).push_back(price_value);
+      std::get<2>(columns).push_back(volume_value);
+    }
+    return std::get<0>(columns).size();
+  }
+
+}  // namespace read_columns_benchmark
+
+auto main(int argc, char ** argv) -> int
+{
+  using namespace read_columns_benchmark;
+
+  auto const rows = benchmark::size_argument(argc, argv, 1'000'000);
+  auto const input = make_input(rows);
+  std::printf("%zu rows of ticker,price,volume, %zu bytes, best of %d runs\n", rows, input.size(), benchmark::repetitions);
+
+  benchmark::report_throughput("nt::read_columns", input.size(), [&] { return read_columns(input); });
+  benchmark::report_throughput("std::getline and std::istream >>", input.size(), [&] { return read_stream(input); });
+}
@@ -0,0 +1,100 @@
+#include "benchmark.hpp"
+#include "newtype/newtype.hpp"
+#include "newtype/variant_of.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <variant>
+#include <vector>
+
+namespace variant_of_benchmark
+{
+
+  using order_id = nt::new_type<std::uint64_t, struct order_id_tag>;
+  using quote_id = nt::new_type<std::uint64_t, struct quote_id_tag>;
+  using trade_id = nt::new_type<std::uint64_t, struct trade_id_tag>;
+
+  using std_id = std::variant<order_id, quote_id, trade_id>;
+  using packed_id = nt::variant_of<order_id, quote_id, trade_id>;
+
+  struct weigh
+  {
+    auto operator()(order_id const & id) const -> std::size_t
+    {
+      return id.decay();
+    }
+
+    auto operator()(quote_id const & id) const -> std::size_t
+    {
+      return id.decay() * 3;
+    }
+
+    auto operator()(trade_id const & id) const -> std::size_t
+    {
+      return id.decay() * 7;
+    }
+  };
+
+  template<typename VariantType>
+  auto make_ids(std::size_t size) -> std::vector<VariantType>
+  {
+    auto engine = std::mt19937_64{42};
+    auto ids = std::vector<VariantType>{};
+    ids.reserve(size);
+    for (auto index = std::size_t{}; index < size; ++index)
+    {
+      auto value = engine() % 1'000'000'000;
+      switch (value % 3)
+      {
+      case 0:
+        ids.emplace_back(order_id{value});
+        break;
+      case 1:
+        ids.emplace_back(quote_id{value});
+        break;
+      default:
+        ids.emplace_back(trade_id{value});
+      }
+    }
+    return ids;
+  }
+
+  auto visit_std(std::vector<std_id> const & ids) -> std::size_t
+  {
+    auto total = std::size_t{};
+    for (auto const & id : ids)
+    {
+      total += std::visit(weigh{}, id);
+    }
+    return total;
+  }
+
+  auto visit_packed(std::vector<packed_id> const & ids) -> std::size_t
+  {
+    auto total = std::size_t{};
+    for (auto const & id : ids)
+    {
+      total += nt::visit(weigh{}, id);
+    }
+    return total;
+  }
+
+}  // namespace variant_of_benchmark
+
+auto main(int argc, char ** argv) -> int
+{
+  using namespace variant_of_benchmark;
+
+  auto const size = benchmark::size_argument(argc, argv, 10'000'000);
+  auto const std_ids = make_ids<std_id>(size);
+  auto const packed_ids = make_ids<packed_id>(size);
+
+  std::printf("%zu ids over three alternatives, best of %d runs\n", size, benchmark::repetitions);
+
+  benchmark::report_size("std::variant", sizeof(std_id));
+  benchmark::report_size("nt::variant_of", sizeof(packed_id));
+  benchmark::report_time("std::visit", size, [&] { return visit_std(std_ids); });
+  benchmark::report_time("nt::visit", size, [&] { return visit_packed(packed_ids); });
+}
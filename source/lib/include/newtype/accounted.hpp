@@ -0,0 +1,178 @@
+#ifndef NEWTYPE_ACCOUNTED_HPP
+#define NEWTYPE_ACCOUNTED_HPP
+
+#include "newtype/allocator.hpp"
+#include "newtype/core.hpp"
+
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <utility>
+
+namespace nt
+{
+
+  namespace accounting
+  {
+
+    struct statistics
+    {
+      std::size_t live_bytes;
+      std::size_t peak_bytes;
+      std::size_t allocations;
+      std::size_t deallocations;
+
+      auto constexpr operator==(statistics const &) const noexcept -> bool = default;
+    };
+
+    template<typename TagType>
+    auto constexpr enable_peak_tracking = false;
+
+  }  // namespace accounting
+
+  namespace impl
+  {
+
+    inline namespace accounting
+    {
+
+      template<typename TagType>
+      class accounting_resource final : public std::pmr::memory_resource
+      {
+      public:
+        static auto instance() noexcept -> accounting_resource &
+        {
+          static auto resource = new accounting_resource{};
+          return *resource;
+        }
+
+        auto snapshot() const noexcept -> nt::accounting::statistics
+        {
+          return {
+              .live_bytes = m_live_bytes.load(std::memory_order_relaxed),
+              .peak_bytes = m_peak_bytes.load(std::memory_order_relaxed),
+              .allocations = m_allocations.load(std::memory_order_relaxed),
+              .deallocations = m_deallocations.load(std::memory_order_relaxed),
+          };
+        }
+
+      private:
+        accounting_resource() = default;
+
+        auto do_allocate(std::size_t bytes, std::size_t alignment) -> void * override
+        {
+          auto memory = std::pmr::new_delete_resource()->allocate(bytes, alignment);
+          m_allocations.fetch_add(1, std::memory_order_relaxed);
+          [[maybe_unused]] auto live = m_live_bytes.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+          if constexpr (nt::accounting::enable_peak_tracking<TagType>)
+          {
+            auto peak = m_peak_bytes.load(std::memory_order_relaxed);
+            while (live > peak && !m_peak_bytes.compare_exchange_weak(peak, live, std::memory_order_relaxed))
+            {
+            }
+          }
+          return memory;
+        }
+
+        auto do_deallocate(void * memory, std::size_t bytes, std::size_t alignment) -> void override
+        {
+          std::pmr::new_delete_resource()->deallocate(memory, bytes, alignment);
+          m_live_bytes.fetch_sub(bytes, std::memory_order_relaxed);
+          m_deallocations.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        auto do_is_equal(std::pmr::memory_resource const & other) const noexcept -> bool override
+        {
+          return this == &other;
+        }
+
+        std::atomic<std::size_t> m_live_bytes{};
+        std::atomic<std::size_t> m_peak_bytes{};
+        std::atomic<std::size_t> m_allocations{};
+        std::atomic<std::size_t> m_deallocations{};
+      };
+
+    }  // namespace accounting
+
+    inline namespace storage
+    {
+
+      template<typename BaseType, typename TagType, auto DerivationClause>
+      struct new_type_storage<BaseType, TagType, DerivationClause, true>
+      {
+        static_assert(std::uses_allocator_v<BaseType, std::pmr::polymorphic_allocator<>>,
+                      "The base type must use a polymorphic allocator to derive nt::Accounted");
+
+        constexpr new_type_storage()
+            : m_value(std::make_obj_using_allocator<BaseType>(allocator()))
+        {
+        }
+
+        constexpr new_type_storage(new_type_storage const & other)
+            : m_value(std::make_obj_using_allocator<BaseType>(allocator(), other.m_value))
+        {
+        }
+
+        constexpr new_type_storage(new_type_storage &&) = default;
+
+        constexpr new_type_storage(BaseType const & value)
+            : m_value(std::make_obj_using_allocator<BaseType>(allocator(), value))
+        {
+        }
+
+        constexpr new_type_storage(BaseType && value)
+            : m_value(std::make_obj_using_allocator<BaseType>(allocator(), std::move(value)))
+        {
+        }
+
+        template<typename... ArgumentTypes>
+          requires(std::constructible_from<BaseType, ArgumentTypes...> && !implicitly_constructible<BaseType, ArgumentTypes...>)
+        constexpr explicit new_type_storage(std::in_place_t, ArgumentTypes &&... arguments)
+            : m_value(std::make_obj_using_allocator<BaseType>(allocator(), std::forward<ArgumentTypes>(arguments)...))
+        {
+        }
+
+        template<typename... ArgumentTypes>
+          requires(std::constructible_from<BaseType, ArgumentTypes...> && implicitly_constructible<BaseType, ArgumentTypes...>)
+        constexpr new_type_storage(std::in_place_t, ArgumentTypes &&... arguments)
+            : m_value(std::make_obj_using_allocator<BaseType>(allocator(), std::forward<ArgumentTypes>(arguments)...))
+        {
+        }
+
+        auto constexpr operator=(new_type_storage const &) -> new_type_storage & = default;
+        auto constexpr operator=(new_type_storage &&) -> new_type_storage & = default;
+
+        static auto allocator() noexcept -> std::pmr::polymorphic_allocator<>
+        {
+          return std::addressof(accounting_resource<TagType>::instance());
+        }
+
+        BaseType m_value;
+      };
+
+    }  // namespace storage
+
+  }  // namespace impl
+
+  namespace accounting
+  {
+
+    template<typename TagType>
+    auto resource() noexcept -> std::pmr::memory_resource *
+    {
+      return std::addressof(impl::accounting_resource<TagType>::instance());
+    }
+
+    template<typename TagType>
+    auto snapshot() noexcept -> statistics
+    {
+      return impl::accounting_resource<TagType>::instance().snapshot();
+    }
+
+  }  // namespace accounting
+
+}  // namespace nt
+
+#endif
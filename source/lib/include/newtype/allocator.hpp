@@ -0,0 +1,50 @@
+#ifndef NEWTYPE_ALLOCATOR_HPP
+#define NEWTYPE_ALLOCATOR_HPP
+
+#include "newtype/core.hpp"
+
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace nt
+{
+
+  namespace impl
+  {
+
+    inline namespace storage
+    {
+
+      template<>
+      struct uses_allocator_construction<std::allocator_arg_t>
+      {
+        template<typename BaseType, typename AllocatorType, typename... ArgumentTypes>
+        auto constexpr static enabled =
+            std::uses_allocator_v<BaseType, AllocatorType> &&
+            (std::is_constructible_v<BaseType, std::allocator_arg_t, AllocatorType const &, ArgumentTypes...> ||
+             std::is_constructible_v<BaseType, ArgumentTypes..., AllocatorType const &>);
+
+        template<typename BaseType, typename AllocatorType, typename... ArgumentTypes>
+        auto constexpr static make(AllocatorType const & allocator, ArgumentTypes &&... arguments) -> BaseType
+        {
+          return std::make_obj_using_allocator<BaseType>(allocator, std::forward<ArgumentTypes>(arguments)...);
+        }
+      };
+
+    }  // namespace storage
+
+  }  // namespace impl
+
+}  // namespace nt
+
+namespace std
+{
+  template<typename BaseType, typename TagType, auto DerivationClause, typename AllocatorType>
+  struct uses_allocator<nt::new_type<BaseType, TagType, DerivationClause>, AllocatorType>
+      : std::bool_constant<std::uses_allocator_v<BaseType, AllocatorType> && !nt::derives<decltype(DerivationClause), nt::Accounted>>
+  {
+  };
+}  // namespace std
+
+#endif
@@ -0,0 +1,309 @@
+#ifndef NEWTYPE_COPY_AUDIT_HPP
+#define NEWTYPE_COPY_AUDIT_HPP
+
+#if defined(NEWTYPE_AUDIT_COPIES)
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <ranges>
+#include <source_location>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if __has_include(<execinfo.h>)
+#include <execinfo.h>
+#endif
+#endif
+
+namespace nt
+{
+
+  namespace impl
+  {
+
+#if defined(NEWTYPE_AUDIT_COPIES)
+    auto constexpr audit_copies = true;
+#else
+    auto constexpr audit_copies = false;
+#endif
+
+  }  // namespace impl
+
+#if defined(NEWTYPE_AUDIT_COPIES)
+  namespace copy_audit
+  {
+
+    struct entry
+    {
+      std::string_view type;
+      std::size_t fingerprint;
+      std::size_t copies;
+      std::size_t bytes;
+      std::vector<std::string> frames;
+    };
+
+    using violation_handler = void (*)(entry const &);
+
+  }  // namespace copy_audit
+
+  namespace impl
+  {
+
+    inline namespace copy_auditing
+    {
+
+      template<typename SubjectType>
+      auto constexpr type_name() noexcept -> std::string_view
+      {
+        auto name = std::string_view{std::source_location::current().function_name()};
+        auto first = name.find("= ", name.rfind('['));
+        if (first == std::string_view::npos)
+        {
+          return name;
+        }
+        name.remove_prefix(first + 2);
+        return name.substr(0, name.find_first_of(";]"));
+      }
+
+      template<typename BaseType>
+      auto footprint(BaseType const & value) noexcept -> std::size_t
+      {
+        auto bytes = sizeof(BaseType);
+        if constexpr (std::ranges::sized_range<BaseType const>)
+        {
+          bytes += static_cast<std::size_t>(std::ranges::size(value)) * sizeof(std::ranges::range_value_t<BaseType const>);
+        }
+        return bytes;
+      }
+
+      inline auto write_entry(std::ostream & output, copy_audit::entry const & entry) -> void
+      {
+        output << entry.copies << " copies, " << entry.bytes << " bytes: " << entry.type << " [" << std::hex << entry.fingerprint
+               << std::dec << "]\n";
+        for (auto const & frame : entry.frames)
+        {
+          output << "    " << frame << '\n';
+        }
+      }
+
+      inline auto abort_on_violation(copy_audit::entry const & entry) -> void
+      {
+        auto message = std::ostringstream{};
+        message << "nt::no_copies_scope: copy of " << entry.type << " inside a critical section\n";
+        write_entry(message, entry);
+        std::fputs(message.str().c_str(), stderr);
+        std::abort();
+      }
+
+      inline thread_local auto no_copies_depth = std::size_t{};
+
+      class copy_registry
+      {
+      public:
+        copy_registry() = default;
+        copy_registry(copy_registry const &) = delete;
+        auto operator=(copy_registry const &) -> copy_registry & = delete;
+
+        ~copy_registry()
+        {
+          auto entries = snapshot();
+          if (entries.empty())
+          {
+            return;
+          }
+
+          auto report = std::ostringstream{};
+          report << "nt::copy_audit: hidden copies, ranked by bytes copied\n";
+          for (auto const & entry : entries)
+          {
+            write_entry(report, entry);
+          }
+          std::fputs(report.str().c_str(), stderr);
+        }
+
+        static auto instance() -> copy_registry &
+        {
+          static auto registry = copy_registry{};
+          return registry;
+        }
+
+        auto record(std::string_view type, std::size_t bytes) -> copy_audit::entry
+        {
+          auto frames = std::vector<void *>(max_frames);
+          auto depth = capture(frames);
+          auto fingerprint = std::hash<std::string_view>{}(type);
+          for (auto frame : frames | std::views::take(depth))
+          {
+            fingerprint = fingerprint * 31 + std::hash<void *>{}(frame);
+          }
+
+          auto lock = std::scoped_lock{m_mutex};
+          auto [position, inserted] = m_entries.try_emplace(std::pair{type, fingerprint}, copy_audit::entry{type, fingerprint, 0, 0, {}});
+          auto & entry = position->second;
+          if (inserted)
+          {
+            entry.frames = symbolize(frames, depth);
+          }
+          ++entry.copies;
+          entry.bytes += bytes;
+          return entry;
+        }
+
+        auto snapshot() -> std::vector<copy_audit::entry>
+        {
+          auto lock = std::scoped_lock{m_mutex};
+          auto entries = std::vector<copy_audit::entry>{};
+          entries.reserve(m_entries.size());
+          std::ranges::copy(m_entries | std::views::values, std::back_inserter(entries));
+          std::ranges::sort(entries, std::ranges::greater{}, [](auto const & entry) { return std::pair{entry.bytes, entry.copies}; });
+          return entries;
+        }
+
+        auto reset() -> void
+        {
+          auto lock = std::scoped_lock{m_mutex};
+          m_entries.clear();
+        }
+
+        auto handler(copy_audit::violation_handler replacement) noexcept -> copy_audit::violation_handler
+        {
+          auto lock = std::scoped_lock{m_mutex};
+          return std::exchange(m_handler, replacement ? replacement : abort_on_violation);
+        }
+
+        auto handler() noexcept -> copy_audit::violation_handler
+        {
+          auto lock = std::scoped_lock{m_mutex};
+          return m_handler;
+        }
+
+      private:
+        auto static constexpr max_frames = std::size_t{32};
+
+        static auto capture([[maybe_unused]] std::vector<void *> & frames) noexcept -> std::size_t
+        {
+#if __has_include(<execinfo.h>)
+          return static_cast<std::size_t>(::backtrace(frames.data(), static_cast<int>(frames.size())));
+#else
+          return 0;
+#endif
+        }
+
+        static auto symbolize([[maybe_unused]] std::vector<void *> const & frames, [[maybe_unused]] std::size_t depth)
+            -> std::vector<std::string>
+        {
+          auto symbols = std::vector<std::string>{};
+#if __has_include(<execinfo.h>)
+          auto names = ::backtrace_symbols(frames.data(), static_cast<int>(depth));
+          if (names)
+          {
+            symbols.assign(names, names + depth);
+            std::free(names);
+          }
+#endif
+          return symbols;
+        }
+
+        std::mutex m_mutex{};
+        std::map<std::pair<std::string_view, std::size_t>, copy_audit::entry> m_entries{};
+        copy_audit::violation_handler m_handler{abort_on_violation};
+      };
+
+      template<typename TagType, typename BaseType>
+      auto record_copy(BaseType const & value) noexcept -> void
+      {
+        auto & registry = copy_registry::instance();
+        auto entry = copy_audit::entry{};
+        try
+        {
+          entry = registry.record(type_name<TagType>(), footprint(value));
+        }
+        catch (...)
+        {
+          return;
+        }
+
+        if (no_copies_depth)
+        {
+          registry.handler()(entry);
+        }
+      }
+
+    }  // namespace copy_auditing
+
+  }  // namespace impl
+
+  namespace copy_audit
+  {
+
+    inline auto snapshot() -> std::vector<entry>
+    {
+      return impl::copy_registry::instance().snapshot();
+    }
+
+    inline auto report(std::ostream & output) -> void
+    {
+      for (auto const & entry : snapshot())
+      {
+        impl::write_entry(output, entry);
+      }
+    }
+
+    inline auto reset() -> void
+    {
+      impl::copy_registry::instance().reset();
+    }
+
+    inline auto set_violation_handler(violation_handler handler) noexcept -> violation_handler
+    {
+      return impl::copy_registry::instance().handler(handler);
+    }
+
+  }  // namespace copy_audit
+
+  class no_copies_scope
+  {
+  public:
+    no_copies_scope() noexcept
+    {
+      ++impl::no_copies_depth;
+    }
+
+    ~no_copies_scope() noexcept
+    {
+      --impl::no_copies_depth;
+    }
+
+    no_copies_scope(no_copies_scope const &) = delete;
+    auto operator=(no_copies_scope const &) -> no_copies_scope & = delete;
+  };
+#else
+  class no_copies_scope
+  {
+  public:
+    constexpr no_copies_scope() noexcept
+    {
+    }
+
+    constexpr ~no_copies_scope() noexcept
+    {
+    }
+
+    no_copies_scope(no_copies_scope const &) = delete;
+    auto operator=(no_copies_scope const &) -> no_copies_scope & = delete;
+  };
+#endif
+
+}  // namespace nt
+
+#endif
@@ -0,0 +1,1958 @@
+#ifndef NEWTYPE_CORE_HPP
+#define NEWTYPE_CORE_HPP
+
+#include "newtype/copy_audit.hpp"
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <type_traits>
+#include <utility>
+
+namespace nt
+{
+
+  template<typename DerivableTag>
+  struct derivable final
+  {
+    using tag_type = DerivableTag;
+  };
+
+  inline namespace derivables
+  {
+
+    template<auto Value>
+    struct sentinel_tag
+    {
+      auto constexpr static value = Value;
+    };
+
+    auto constexpr Accounted = derivable<struct accounted_tag>{};
+    auto constexpr Arithmetic = derivable<struct arithmetic_tag>{};
+    auto constexpr CachedHash = derivable<struct cached_hash_tag>{};
+    auto constexpr Container = derivable<struct container_tag>{};
+    auto constexpr DefaultInit = derivable<struct default_init_tag>{};
+    auto constexpr EqBase = derivable<struct eq_base_tag>{};
+    auto constexpr Hash = derivable<struct hash_tag>{};
+    auto constexpr ImplicitConversion = derivable<struct implicit_conversion_tag>{};
+    auto constexpr Index = derivable<struct index_tag>{};
+    auto constexpr Indirection = derivable<struct indirection_tag>{};
+    auto constexpr Instrumented = derivable<struct instrumented_tag>{};
+    auto constexpr Iterable = derivable<struct iterable_tag>{};
+    auto constexpr MoveOnly = derivable<struct move_only_tag>{};
+    auto constexpr Read = derivable<struct read_tag>{};
+    auto constexpr Relational = derivable<struct relational_tag>{};
+    template<auto Value>
+    auto constexpr Sentinel = derivable<sentinel_tag<Value>>{};
+    auto constexpr Show = derivable<struct show_tag>{};
+    auto constexpr Subscript = derivable<struct subscript_tag>{};
+
+  }  // namespace derivables
+
+  namespace impl
+  {
+
+    inline namespace feature_masks
+    {
+
+      template<typename NeedleType, typename... HaystackTypes>
+      auto constexpr first_index() noexcept -> std::size_t
+      {
+        auto index = std::size_t{};
+        auto found = ((std::is_same_v<NeedleType, HaystackTypes> ? true : (++index, false)) || ...);
+        return found ? index : sizeof...(HaystackTypes);
+      }
+
+      template<std::size_t Index, typename Type>
+      struct indexed_type
+      {
+        using type = Type;
+      };
+
+      template<typename IndexSequence, typename... Types>
+      struct indexed_types;
+
+      template<std::size_t... Indices, typename... Types>
+      struct indexed_types<std::index_sequence<Indices...>, Types...> : indexed_type<Indices, Types>...
+      {
+      };
+
+      template<std::size_t Index, typename Type>
+      auto select(indexed_type<Index, Type> const &) -> indexed_type<Index, Type>;
+
+      template<std::size_t Index, typename... Types>
+      using type_at = typename decltype(select<Index>(std::declval<indexed_types<std::index_sequence_for<Types...>, Types...>>()))::type;
+
+      template<typename... DerivableTags>
+      struct derivable_list
+      {
+        template<typename DerivableTag>
+        auto constexpr static index = first_index<DerivableTag, DerivableTags...>();
+
+        template<std::size_t Index>
+        using at = type_at<Index, DerivableTags...>;
+      };
+
+      using standard_derivables = derivable_list<accounted_tag,
+                                                 arithmetic_tag,
+                                                 cached_hash_tag,
+                                                 container_tag,
+                                                 default_init_tag,
+                                                 eq_base_tag,
+                                                 hash_tag,
+                                                 implicit_conversion_tag,
+                                                 index_tag,
+                                                 indirection_tag,
+                                                 instrumented_tag,
+                                                 iterable_tag,
+                                                 move_only_tag,
+                                                 read_tag,
+                                                 relational_tag,
+                                                 show_tag,
+                                                 subscript_tag>;
+
+      template<typename DerivableTag>
+      auto constexpr feature_index = standard_derivables::index<DerivableTag>;
+
+      auto constexpr feature_count = feature_index<void>;
+
+      template<typename DerivableTag>
+      auto constexpr feature_bit =
+          feature_index<DerivableTag> < feature_count ? std::uint64_t{1} << feature_index<DerivableTag> : std::uint64_t{};
+
+      template<typename NeedleTag, typename... DerivableTags>
+      auto constexpr lists = (std::is_same_v<NeedleTag, DerivableTags> || ...);
+
+    }  // namespace feature_masks
+
+  }  // namespace impl
+
+  template<typename... DerivableTags>
+  struct derivation_clause
+  {
+    auto constexpr static features = (impl::feature_bit<DerivableTags> | ... | std::uint64_t{});
+
+    template<typename... NeedleTags>
+    auto constexpr static contains =
+        (features & (impl::feature_bit<NeedleTags> | ... | std::uint64_t{})) == (impl::feature_bit<NeedleTags> | ... | std::uint64_t{}) &&
+        ((impl::feature_bit<NeedleTags> || impl::lists<NeedleTags, DerivableTags...>) && ...);
+
+    template<auto Needle>
+    using derives_one = std::bool_constant<contains<typename decltype(Needle)::tag_type>>;
+
+    template<auto... Needles>
+    using derives = std::bool_constant<contains<typename decltype(Needles)::tag_type...>>;
+
+    constexpr derivation_clause(derivable<DerivableTags>...) noexcept
+    {
+    }
+  };
+
+  template<typename DerivationClause, auto... Features>
+  concept derives = requires { requires DerivationClause::template contains<typename decltype(Features)::tag_type...>; };
+
+  namespace impl
+  {
+
+    inline namespace canonicalization
+    {
+
+      template<typename DerivableTag>
+      struct derivable_name;
+
+      template<typename DerivableTag>
+      auto constexpr is_sentinel_tag = false;
+
+      template<auto Value>
+      auto constexpr is_sentinel_tag<sentinel_tag<Value>> = true;
+
+      struct derivable_key
+      {
+        std::size_t index;
+        char const * name;
+      };
+
+      template<typename DerivableTag>
+      auto constexpr key_of() noexcept -> derivable_key
+      {
+        if constexpr (feature_index<DerivableTag> < feature_count)
+        {
+          return {feature_index<DerivableTag>, ""};
+        }
+        else if constexpr (is_sentinel_tag<DerivableTag>)
+        {
+          return {feature_count, ""};
+        }
+        else
+        {
+          return {feature_count + 1, derivable_name<DerivableTag>::value};
+        }
+      }
+
+      auto constexpr precedes(derivable_key lhs, derivable_key rhs) noexcept -> bool
+      {
+        if (lhs.index != rhs.index)
+        {
+          return lhs.index < rhs.index;
+        }
+
+        auto position = std::size_t{};
+        while (lhs.name[position] != '\0' && lhs.name[position] == rhs.name[position])
+        {
+          ++position;
+        }
+        return static_cast<unsigned char>(lhs.name[position]) < static_cast<unsigned char>(rhs.name[position]);
+      }
+
+      template<std::size_t Size>
+      struct permutation
+      {
+        std::size_t order[Size + 1];
+        std::size_t size;
+      };
+
+      template<typename... DerivableTags>
+      auto constexpr canonical_order() noexcept -> permutation<sizeof...(DerivableTags)>
+      {
+        derivable_key const keys[]{key_of<DerivableTags>()..., {}};
+        std::size_t const first[]{first_index<DerivableTags, DerivableTags...>()..., 0};
+
+        auto result = permutation<sizeof...(DerivableTags)>{};
+        for (auto index = std::size_t{}; index < sizeof...(DerivableTags); ++index)
+        {
+          if (first[index] == index)
+          {
+            result.order[result.size++] = index;
+          }
+        }
+
+        for (auto current = std::size_t{1}; current < result.size; ++current)
+        {
+          for (auto position = current; position > 0 && precedes(keys[result.order[position]], keys[result.order[position - 1]]); --position)
+          {
+            std::swap(result.order[position], result.order[position - 1]);
+          }
+        }
+        return result;
+      }
+
+      template<typename IndexSequence, typename... DerivableTags>
+      struct canonical_clause_of;
+
+      template<std::size_t... Indices, typename... DerivableTags>
+      struct canonical_clause_of<std::index_sequence<Indices...>, DerivableTags...>
+      {
+        auto constexpr static order = canonical_order<DerivableTags...>();
+
+        using type = derivation_clause<type_at<order.order[Indices], DerivableTags...>...>;
+
+        auto constexpr static value = type{derivable<type_at<order.order[Indices], DerivableTags...>>{}...};
+      };
+
+      template<std::uint64_t Features>
+      auto constexpr standard_order() noexcept -> permutation<feature_count>
+      {
+        auto result = permutation<feature_count>{};
+        for (auto index = std::size_t{}; index < feature_count; ++index)
+        {
+          if (Features & (std::uint64_t{1} << index))
+          {
+            result.order[result.size++] = index;
+          }
+        }
+        return result;
+      }
+
+      template<typename IndexSequence, std::uint64_t Features>
+      struct standard_clause_of;
+
+      template<std::size_t... Indices, std::uint64_t Features>
+      struct standard_clause_of<std::index_sequence<Indices...>, Features>
+      {
+        auto constexpr static order = standard_order<Features>();
+
+        using type = derivation_clause<standard_derivables::at<order.order[Indices]>...>;
+
+        auto constexpr static value = type{derivable<standard_derivables::at<order.order[Indices]>>{}...};
+      };
+
+      template<bool OnlyStandard, typename... DerivableTags>
+      struct canonical_clause_for
+          : canonical_clause_of<std::make_index_sequence<canonical_order<DerivableTags...>().size>, DerivableTags...>
+      {
+      };
+
+      template<typename... DerivableTags>
+      struct canonical_clause_for<true, DerivableTags...>
+          : standard_clause_of<std::make_index_sequence<standard_order<(feature_bit<DerivableTags> | ... | std::uint64_t{})>().size>,
+                               (feature_bit<DerivableTags> | ... | std::uint64_t{})>
+      {
+      };
+
+      template<typename... DerivableTags>
+      using canonical_clause = canonical_clause_for<((feature_bit<DerivableTags> != 0) && ...), DerivableTags...>;
+
+    }  // namespace canonicalization
+
+  }  // namespace impl
+
+  template<typename... DerivableTags>
+  auto constexpr deriving(derivable<DerivableTags>...) noexcept -> typename impl::canonical_clause<DerivableTags...>::type
+  {
+    return impl::canonical_clause<DerivableTags...>::value;
+  }
+
+  namespace impl
+  {
+
+    inline namespace counting
+    {
+
+      enum struct operation : std::size_t
+      {
+        construction,
+        copy,
+        move,
+        copy_assignment,
+        move_assignment,
+        arithmetic,
+        comparison,
+        hash,
+        count,
+      };
+
+      template<typename TagType>
+      struct operation_counters;
+
+      template<typename TagType, auto DerivationClause>
+      auto constexpr record(operation performed) noexcept -> void
+      {
+        if constexpr (nt::derives<decltype(DerivationClause), nt::Instrumented>)
+        {
+          if (!std::is_constant_evaluated())
+          {
+            operation_counters<TagType>::increment(performed);
+          }
+        }
+      }
+
+    }  // namespace counting
+
+    inline namespace storage
+    {
+
+      template<typename BaseType, typename... ArgumentTypes>
+      concept implicitly_constructible = sizeof...(ArgumentTypes) == 1 && (std::is_convertible_v<ArgumentTypes, BaseType> && ...);
+
+      template<typename AllocatorArgType>
+      struct uses_allocator_construction
+      {
+        template<typename BaseType, typename AllocatorType, typename... ArgumentTypes>
+        auto constexpr static enabled = false;
+      };
+
+      template<typename BaseType, typename AllocatorArgType, typename AllocatorType, typename... ArgumentTypes>
+      concept uses_allocator_constructible =
+          uses_allocator_construction<AllocatorArgType>::template enabled<BaseType, AllocatorType, ArgumentTypes...>;
+
+      template<typename BaseType, typename TagType, auto DerivationClause, bool = nt::derives<decltype(DerivationClause), nt::Accounted>>
+      struct new_type_storage;
+
+      template<typename BaseType, typename TagType, auto DerivationClause>
+      struct new_type_storage<BaseType, TagType, DerivationClause, false>
+      {
+        constexpr new_type_storage() noexcept(std::is_nothrow_default_constructible_v<BaseType>)
+          requires(!nt::derives<decltype(DerivationClause), nt::DefaultInit>)
+            : m_value{}
+        {
+        }
+
+        constexpr new_type_storage()
+          requires(nt::derives<decltype(DerivationClause), nt::DefaultInit>)
+        = default;
+
+        constexpr new_type_storage(BaseType const & value)
+            : m_value{value}
+        {
+        }
+
+        constexpr new_type_storage(BaseType && value)
+            : m_value{std::move(value)}
+        {
+        }
+
+        template<typename... ArgumentTypes>
+          requires(std::constructible_from<BaseType, ArgumentTypes...> && !implicitly_constructible<BaseType, ArgumentTypes...>)
+        constexpr explicit new_type_storage(std::in_place_t, ArgumentTypes &&... arguments) noexcept(
+            std::is_nothrow_constructible_v<BaseType, ArgumentTypes...>)
+            : m_value(std::forward<ArgumentTypes>(arguments)...)
+        {
+        }
+
+        template<typename... ArgumentTypes>
+          requires(std::constructible_from<BaseType, ArgumentTypes...> && implicitly_constructible<BaseType, ArgumentTypes...>)
+        constexpr new_type_storage(std::in_place_t, ArgumentTypes &&... arguments) noexcept(
+            std::is_nothrow_constructible_v<BaseType, ArgumentTypes...>)
+            : m_value(std::forward<ArgumentTypes>(arguments)...)
+        {
+        }
+
+        template<typename AllocatorArgType, typename AllocatorType, typename... ArgumentTypes>
+          requires uses_allocator_constructible<BaseType, AllocatorArgType, AllocatorType, ArgumentTypes...>
+        constexpr new_type_storage(AllocatorArgType, AllocatorType const & allocator, ArgumentTypes &&... arguments)
+            : m_value(uses_allocator_construction<AllocatorArgType>::template make<BaseType>(allocator,
+                                                                                              std::forward<ArgumentTypes>(arguments)...))
+        {
+        }
+
+        BaseType m_value;
+      };
+
+      template<typename BaseType, typename TagType, auto DerivationClause, bool = nt::derives<decltype(DerivationClause), nt::CachedHash>>
+      struct new_type_hash_cache;
+
+      template<typename BaseType, typename TagType, auto DerivationClause>
+      struct new_type_hash_cache<BaseType, TagType, DerivationClause, false> : new_type_storage<BaseType, TagType, DerivationClause>
+      {
+        using new_type_storage<BaseType, TagType, DerivationClause>::new_type_storage;
+
+        constexpr new_type_hash_cache() = default;
+
+        auto constexpr rehash() noexcept -> void
+        {
+        }
+      };
+
+      template<typename BaseType, typename TagType, auto DerivationClause, bool = nt::derives<decltype(DerivationClause), nt::Instrumented>>
+      struct new_type_instrumentation;
+
+      template<typename BaseType, typename TagType, auto DerivationClause>
+      struct new_type_instrumentation<BaseType, TagType, DerivationClause, false> : new_type_hash_cache<BaseType, TagType, DerivationClause>
+      {
+        using new_type_hash_cache<BaseType, TagType, DerivationClause>::new_type_hash_cache;
+
+        constexpr new_type_instrumentation() = default;
+      };
+
+      template<typename TagType, typename BaseType>
+      auto constexpr audit_copy([[maybe_unused]] BaseType const & value) noexcept -> void
+      {
+        if constexpr (audit_copies && !std::is_trivially_copyable_v<BaseType>)
+        {
+          if (!std::is_constant_evaluated())
+          {
+            record_copy<TagType>(value);
+          }
+        }
+      }
+
+      template<typename BaseType, typename TagType, auto DerivationClause, bool = audit_copies && !std::is_trivially_copyable_v<BaseType>>
+      struct new_type_copy_audit : new_type_instrumentation<BaseType, TagType, DerivationClause>
+      {
+        using new_type_instrumentation<BaseType, TagType, DerivationClause>::new_type_instrumentation;
+
+        constexpr new_type_copy_audit() = default;
+      };
+
+      template<typename BaseType, typename TagType, auto DerivationClause>
+      struct new_type_copy_audit<BaseType, TagType, DerivationClause, true> : new_type_instrumentation<BaseType, TagType, DerivationClause>
+      {
+        using new_type_instrumentation<BaseType, TagType, DerivationClause>::new_type_instrumentation;
+
+        constexpr new_type_copy_audit() = default;
+
+        constexpr new_type_copy_audit(new_type_copy_audit const & other)
+            : new_type_instrumentation<BaseType, TagType, DerivationClause>(other)
+        {
+          audit_copy<TagType>(other.m_value);
+        }
+
+        constexpr new_type_copy_audit(new_type_copy_audit &&) = default;
+
+        auto constexpr operator=(new_type_copy_audit const & other) -> new_type_copy_audit &
+        {
+          new_type_instrumentation<BaseType, TagType, DerivationClause>::operator=(other);
+          audit_copy<TagType>(other.m_value);
+          return *this;
+        }
+
+        auto constexpr operator=(new_type_copy_audit &&) -> new_type_copy_audit & = default;
+      };
+
+      template<typename BaseType, typename TagType, auto DerivationClause, bool = std::is_default_constructible_v<BaseType>>
+      struct new_type_constructor : new_type_copy_audit<BaseType, TagType, DerivationClause>
+      {
+        using new_type_copy_audit<BaseType, TagType, DerivationClause>::new_type_copy_audit;
+
+        constexpr new_type_constructor() = default;
+      };
+
+      template<typename BaseType, typename TagType, auto DerivationClause>
+      struct new_type_constructor<BaseType, TagType, DerivationClause, false> : new_type_copy_audit<BaseType, TagType, DerivationClause>
+      {
+        using new_type_copy_audit<BaseType, TagType, DerivationClause>::new_type_copy_audit;
+
+        constexpr new_type_constructor() = delete;
+      };
+
+      template<typename BaseType,
+               typename TagType,
+               auto DerivationClause,
+               bool = std::is_copy_constructible_v<BaseType> && !nt::derives<decltype(DerivationClause), nt::MoveOnly>>
+      struct new_type_copy_constructor : new_type_constructor<BaseType, TagType, DerivationClause>
+      {
+        using new_type_constructor<BaseType, TagType, DerivationClause>::new_type_constructor;
+
+        constexpr new_type_copy_constructor() = default;
+        constexpr new_type_copy_constructor(new_type_copy_constructor const &) = default;
+        constexpr new_type_copy_constructor(new_type_copy_constructor &&) = default;
+        auto constexpr operator=(new_type_copy_constructor const &) -> new_type_copy_constructor & = default;
+        auto constexpr operator=(new_type_copy_constructor &&) -> new_type_copy_constructor & = default;
+      };
+
+      template<typename BaseType, typename TagType, auto DerivationClause>
+      struct new_type_copy_constructor<BaseType, TagType, DerivationClause, false> : new_type_constructor<BaseType, TagType, DerivationClause>
+      {
+        using new_type_constructor<BaseType, TagType, DerivationClause>::new_type_constructor;
+
+        constexpr new_type_copy_constructor() = default;
+        constexpr new_type_copy_constructor(new_type_copy_constructor const &) = delete;
+        constexpr new_type_copy_constructor(new_type_copy_constructor &&) = default;
+        constexpr new_type_copy_constructor(BaseType const &) = delete;
+        auto constexpr operator=(new_type_copy_constructor const &) -> new_type_copy_constructor & = default;
+        auto constexpr operator=(new_type_copy_constructor &&) -> new_type_copy_constructor & = default;
+      };
+
+      template<typename BaseType, typename TagType, auto DerivationClause, bool = std::is_move_constructible_v<BaseType>>
+      struct new_type_move_constructor : new_type_copy_constructor<BaseType, TagType, DerivationClause>
+      {
+        using new_type_copy_constructor<BaseType, TagType, DerivationClause>::new_type_copy_constructor;
+
+        constexpr new_type_move_constructor() = default;
+        constexpr new_type_move_constructor(new_type_move_constructor const &) = default;
+        constexpr new_type_move_constructor(new_type_move_constructor &&) = default;
+        auto constexpr operator=(new_type_move_constructor const &) -> new_type_move_constructor & = default;
+        auto constexpr operator=(new_type_move_constructor &&) -> new_type_move_constructor & = default;
+      };
+
+      template<typename BaseType, typename TagType, auto DerivationClause>
+      struct new_type_move_constructor<BaseType, TagType, DerivationClause, false>
+          : new_type_copy_constructor<BaseType, TagType, DerivationClause>
+      {
+        using new_type_copy_constructor<BaseType, TagType, DerivationClause>::new_type_copy_constructor;
+
+        constexpr new_type_move_constructor() = default;
+        constexpr new_type_move_constructor(new_type_move_constructor const &) = default;
+        constexpr new_type_move_constructor(new_type_move_constructor &&) = delete;
+        constexpr new_type_move_constructor(BaseType &&) = delete;
+        auto constexpr operator=(new_type_move_constructor const &) -> new_type_move_constructor & = default;
+        auto constexpr operator=(new_type_move_constructor &&) -> new_type_move_constructor & = default;
+      };
+
+      template<typename BaseType,
+               typename TagType,
+               auto DerivationClause,
+               bool = std::is_copy_assignable_v<BaseType> && !nt::derives<decltype(DerivationClause), nt::MoveOnly>>
+      struct new_type_copy_assignment : new_type_move_constructor<BaseType, TagType, DerivationClause>
+      {
+        using new_type_move_constructor<BaseType, TagType, DerivationClause>::new_type_move_constructor;
+
+        constexpr new_type_copy_assignment() = default;
+        constexpr new_type_copy_assignment(new_type_copy_assignment const &) = default;
+        constexpr new_type_copy_assignment(new_type_copy_assignment &&) = default;
+        auto constexpr operator=(new_type_copy_assignment const &) -> new_type_copy_assignment & = default;
+        auto constexpr operator=(new_type_copy_assignment &&) -> new_type_copy_assignment & = default;
+      };
+
+      template<typename BaseType, typename TagType, auto DerivationClause>
+      struct new_type_copy_assignment<BaseType, TagType, DerivationClause, false>
+          : new_type_move_constructor<BaseType, TagType, DerivationClause>
+      {
+        using new_type_move_constructor<BaseType, TagType, DerivationClause>::new_type_move_constructor;
+
+        constexpr new_type_copy_assignment() = default;
+        constexpr new_type_copy_assignment(new_type_copy_assignment const &) = default;
+        constexpr new_type_copy_assignment(new_type_copy_assignment &&) = default;
+        auto constexpr operator=(new_type_copy_assignment const &) -> new_type_copy_assignment & = delete;
+        auto constexpr operator=(new_type_copy_assignment &&) -> new_type_copy_assignment & = default;
+      };
+
+      template<typename BaseType, typename TagType, auto DerivationClause, bool = std::is_move_assignable_v<BaseType>>
+      struct new_type_move_assignment : new_type_copy_assignment<BaseType, TagType, DerivationClause>
+      {
+        using new_type_copy_assignment<BaseType, TagType, DerivationClause>::new_type_copy_assignment;
+
+        constexpr new_type_move_assignment() = default;
+        constexpr new_type_move_assignment(new_type_move_assignment const &) = default;
+        constexpr new_type_move_assignment(new_type_move_assignment &&) = default;
+        auto constexpr operator=(new_type_move_assignment const &) -> new_type_move_assignment & = default;
+        auto constexpr operator=(new_type_move_assignment &&) -> new_type_move_assignment & = default;
+      };
+
+      template<typename BaseType, typename TagType, auto DerivationClause>
+      struct new_type_move_assignment<BaseType, TagType, DerivationClause, false>
+          : new_type_copy_assignment<BaseType, TagType, DerivationClause>
+      {
+        using new_type_copy_assignment<BaseType, TagType, DerivationClause>::new_type_copy_assignment;
+
+        constexpr new_type_move_assignment() = default;
+        constexpr new_type_move_assignment(new_type_move_assignment const &) = default;
+        constexpr new_type_move_assignment(new_type_move_assignment &&) = default;
+        auto constexpr operator=(new_type_move_assignment const &) -> new_type_move_assignment & = default;
+        auto constexpr operator=(new_type_move_assignment &&) -> new_type_move_assignment & = delete;
+      };
+
+    }  // namespace storage
+
+    inline namespace member_types
+    {
+
+      template<typename T>
+      struct difference_type_of
+      {
+      };
+
+      template<typename T>
+        requires requires { typename T::difference_type; }
+      struct difference_type_of<T>
+      {
+        using type = typename T::difference_type;
+      };
+
+      template<typename T>
+        requires(!requires { typename T::difference_type; } && requires(T const & lhs, T const & rhs) {
+          {
+            lhs - rhs
+          } -> std::integral;
+        })
+      struct difference_type_of<T>
+      {
+        using type = std::make_signed_t<decltype(std::declval<T const &>() - std::declval<T const &>())>;
+      };
+
+      template<typename T>
+      using difference_type_of_t = typename difference_type_of<std::remove_cv_t<T>>::type;
+
+      template<typename T, bool = false, typename = std::void_t<>>
+      struct new_type_difference_type
+      {
+      };
+
+      template<typename T>
+      struct new_type_difference_type<T, true, std::void_t<difference_type_of_t<T>>>
+      {
+        using difference_type = difference_type_of_t<T>;
+      };
+
+      template<typename T, typename = std::void_t<>>
+      struct new_type_allocator_type
+      {
+      };
+
+      template<typename T>
+      struct new_type_allocator_type<T, std::void_t<typename T::allocator_type>>
+      {
+        using allocator_type = typename T::allocator_type;
+      };
+
+      template<typename T, bool Enabled>
+      struct new_type_iterator_types;
+
+      template<typename T>
+      struct new_type_iterator_types<T, false>
+      {
+      };
+
+    }  // namespace member_types
+
+    struct new_type_access
+    {
+      template<typename NewType>
+      auto constexpr static value(NewType & object) noexcept -> auto &
+      {
+        return object.m_value;
+      }
+
+      template<typename NewType>
+      auto constexpr static hash(NewType const & object) noexcept -> std::size_t
+      {
+        return object.m_hash;
+      }
+
+      template<typename NewType>
+      auto constexpr static rehash(NewType & object) noexcept(noexcept(object.rehash())) -> void
+      {
+        object.rehash();
+      }
+    };
+
+  }    // namespace impl
+
+  inline namespace lib
+  {
+    constexpr struct
+    {
+      int const major;
+      int const minor;
+      int const patch;
+
+      char const * const name;
+    } version{
+        .major = 2,
+        .minor = 0,
+        .patch = 0,
+        .name = "Brynn",
+    };
+
+  }  // namespace lib
+
+  namespace concepts
+  {
+
+    inline namespace arithmetic
+    {
+
+      template<typename SubjectType>
+      concept addable = requires(SubjectType lhs, SubjectType rhs) {
+        {
+          lhs + rhs
+        } -> std::same_as<SubjectType>;
+      };
+
+      template<typename SubjectType>
+      concept nothrow_addable = requires(SubjectType lhs, SubjectType rhs) {
+        requires addable<SubjectType>;
+        {
+          lhs + rhs
+        } noexcept;
+      };
+
+      template<typename SubjectType>
+      concept divisible = requires(SubjectType lhs, SubjectType rhs) {
+        {
+          lhs / rhs
+        } -> std::same_as<SubjectType>;
+      };
+
+      template<typename SubjectType>
+      concept nothrow_divisible = requires(SubjectType lhs, SubjectType rhs) {
+        requires divisible<SubjectType>;
+        {
+          lhs / rhs
+        } noexcept;
+      };
+
+      template<typename SubjectType>
+      concept multipliable = requires(SubjectType lhs, SubjectType rhs) {
+        {
+          lhs * rhs
+        } -> std::same_as<SubjectType>;
+      };
+
+      template<typename SubjectType>
+      concept nothrow_multipliable = requires(SubjectType lhs, SubjectType rhs) {
+        requires multipliable<SubjectType>;
+        {
+          lhs / rhs
+        } noexcept;
+      };
+
+      template<typename SubjectType>
+      concept subtractable = requires(SubjectType lhs, SubjectType rhs) {
+        {
+          lhs - rhs
+        } -> std::same_as<SubjectType>;
+      };
+
+      template<typename SubjectType>
+      concept nothrow_subtractable = requires(SubjectType lhs, SubjectType rhs) {
+        requires subtractable<SubjectType>;
+        {
+          lhs - rhs
+        } noexcept;
+      };
+
+    }  // namespace arithmetic
+
+    inline namespace comparability
+    {
+
+      template<typename SubjectType>
+      concept equality_comparable = requires(SubjectType lhs, SubjectType rhs) {
+        {
+          lhs == rhs
+        } -> std::convertible_to<bool>;
+      };
+
+      template<typename SubjectType>
+      concept nothrow_equality_comparable = requires(SubjectType lhs, SubjectType rhs) {
+        requires equality_comparable<SubjectType>;
+        {
+          lhs == rhs
+        } noexcept;
+      };
+
+      template<typename SubjectType>
+      concept inequality_comparable = requires(SubjectType lhs, SubjectType rhs) {
+        {
+          lhs != rhs
+        } -> std::convertible_to<bool>;
+      };
+
+      template<typename SubjectType>
+      concept nothrow_inequality_comparable = requires(SubjectType lhs, SubjectType rhs) {
+        requires inequality_comparable<SubjectType>;
+        {
+          lhs != rhs
+        } noexcept;
+      };
+
+      template<typename SubjectType>
+      concept less_than_comparable = requires(SubjectType lhs, SubjectType rhs) {
+        {
+          lhs < rhs
+        } -> std::convertible_to<bool>;
+      };
+
+      template<typename SubjectType>
+      concept nothrow_less_than_comparable = requires(SubjectType lhs, SubjectType rhs) {
+        requires less_than_comparable<SubjectType>;
+        {
+          lhs < rhs
+        } noexcept;
+      };
+
+      template<typename SubjectType>
+      concept less_than_equal_comparable = requires(SubjectType lhs, SubjectType rhs) {
+        {
+          lhs <= rhs
+        } -> std::convertible_to<bool>;
+      };
+
+      template<typename SubjectType>
+      concept nothrow_less_than_equal_comparable = requires(SubjectType lhs, SubjectType rhs) {
+        requires less_than_equal_comparable<SubjectType>;
+        {
+          lhs <= rhs
+        } noexcept;
+      };
+
+      template<typename SubjectType>
+      concept greater_than_comparable = requires(SubjectType lhs, SubjectType rhs) {
+        {
+          lhs > rhs
+        } -> std::convertible_to<bool>;
+      };
+
+      template<typename SubjectType>
+      concept nothrow_greater_than_comparable = requires(SubjectType lhs, SubjectType rhs) {
+        requires greater_than_comparable<SubjectType>;
+        {
+          lhs > rhs
+        } noexcept;
+      };
+
+      template<typename SubjectType>
+      concept greater_than_equal_comparable = requires(SubjectType lhs, SubjectType rhs) {
+        {
+          lhs >= rhs
+        } -> std::convertible_to<bool>;
+      };
+
+      template<typename SubjectType>
+      concept nothrow_greater_than_equal_comparable = requires(SubjectType lhs, SubjectType rhs) {
+        requires greater_than_equal_comparable<SubjectType>;
+        {
+          lhs >= rhs
+        } noexcept;
+      };
+
+    }  // namespace comparability
+
+    inline namespace compound_arithmetic
+    {
+      template<typename SubjectType>
+      concept compound_addable = requires(SubjectType & lhs, SubjectType const & rhs) {
+        {
+          lhs += rhs
+        } -> std::convertible_to<SubjectType &>;
+      };
+
+      template<typename SubjectType>
+      concept nothrow_compound_addable = requires(SubjectType & lhs, SubjectType const & rhs) {
+        requires compound_addable<SubjectType>;
+        {
+          lhs += rhs
+        } noexcept;
+      };
+
+      template<typename SubjectType>
+      concept compound_divisible = requires(SubjectType & lhs, SubjectType const & rhs) {
+        {
+          lhs /= rhs
+        } -> std::convertible_to<SubjectType &>;
+      };
+
+      template<typename SubjectType>
+      concept nothrow_compound_divisible = requires(SubjectType & lhs, SubjectType const & rhs) {
+        requires compound_divisible<SubjectType>;
+        {
+          lhs /= rhs
+        } noexcept;
+      };
+
+      template<typename SubjectType>
+      concept compound_multipliable = requires(SubjectType & lhs, SubjectType const & rhs) {
+        {
+          lhs *= rhs
+        } -> std::convertible_to<SubjectType &>;
+      };
+
+      template<typename SubjectType>
+      concept nothrow_compound_multipliable = requires(SubjectType & lhs, SubjectType const & rhs) {
+        requires compound_multipliable<SubjectType>;
+        {
+          lhs *= rhs
+        } noexcept;
+      };
+
+      template<typename SubjectType>
+      concept compound_subtractable = requires(SubjectType & lhs, SubjectType const & rhs) {
+        {
+          lhs -= rhs
+        } -> std::convertible_to<SubjectType &>;
+      };
+
+      template<typename SubjectType>
+      concept nothrow_compound_subtractable = requires(SubjectType & lhs, SubjectType const & rhs) {
+        requires compound_subtractable<SubjectType>;
+        {
+          lhs -= rhs
+        } noexcept;
+      };
+    }  // namespace compound_arithmetic
+
+    inline namespace steppable
+    {
+
+      template<typename SubjectType>
+      concept incrementable = requires(SubjectType & subject) {
+        {
+          ++subject
+        } -> std::convertible_to<SubjectType &>;
+      };
+
+      template<typename SubjectType>
+      concept nothrow_incrementable = requires(SubjectType & subject) {
+        requires incrementable<SubjectType>;
+        {
+          ++subject
+        } noexcept;
+      };
+
+      template<typename SubjectType>
+      concept decrementable = requires(SubjectType & subject) {
+        {
+          --subject
+        } -> std::convertible_to<SubjectType &>;
+      };
+
+      template<typename SubjectType>
+      concept nothrow_decrementable = requires(SubjectType & subject) {
+        requires decrementable<SubjectType>;
+        {
+          --subject
+        } noexcept;
+      };
+
+      template<typename SubjectType>
+      concept advanceable = requires(SubjectType & subject, impl::difference_type_of_t<SubjectType> offset) {
+        {
+          subject += offset
+        } -> std::convertible_to<SubjectType &>;
+        {
+          subject -= offset
+        } -> std::convertible_to<SubjectType &>;
+      };
+
+      template<typename SubjectType>
+      concept nothrow_advanceable = requires(SubjectType & subject, impl::difference_type_of_t<SubjectType> offset) {
+        requires advanceable<SubjectType>;
+        {
+          subject += offset
+        } noexcept;
+        {
+          subject -= offset
+        } noexcept;
+      };
+
+    }  // namespace steppable
+
+    inline namespace iostreamable
+    {
+
+      template<typename SubjectType, typename CharType, typename StreamTraits>
+      concept input_streamable = requires(SubjectType subject) {
+        {
+          std::declval<std::basic_istream<CharType, StreamTraits> &>() >> subject
+        } -> std::same_as<std::basic_istream<CharType, StreamTraits> &>;
+      };
+
+      template<typename SubjectType, typename CharType, typename StreamTraits>
+      concept nothrow_input_streamable = requires(SubjectType subject) {
+        requires input_streamable<SubjectType, CharType, StreamTraits>;
+        {
+          std::declval<std::basic_istream<CharType, StreamTraits> &>() >> subject
+        } noexcept;
+      };
+
+      template<typename SubjectType, typename CharType, typename StreamTraits>
+      concept output_streamable = requires(SubjectType subject) {
+        {
+          std::declval<std::basic_ostream<CharType, StreamTraits> &>() << subject
+        } -> std::same_as<std::basic_ostream<CharType, StreamTraits> &>;
+      };
+
+      template<typename SubjectType, typename CharType, typename StreamTraits>
+      concept nothrow_output_streamable = requires(SubjectType subject) {
+        requires output_streamable<SubjectType, CharType, StreamTraits>;
+        {
+          std::declval<std::basic_ostream<CharType, StreamTraits> &>() << subject
+        } noexcept;
+      };
+
+    }  // namespace iostreamable
+
+    inline namespace iterable
+    {
+
+      template<typename SubjectType>
+      concept free_begin = requires(SubjectType & subject) {
+        typename SubjectType::iterator;
+        {
+          begin(subject)
+        } -> std::same_as<typename SubjectType::iterator>;
+      };
+
+      template<typename SubjectType>
+      concept const_free_begin = requires(SubjectType const & subject) {
+        typename SubjectType::const_iterator;
+        {
+          begin(subject)
+        } -> std::same_as<typename SubjectType::const_iterator>;
+      };
+
+      template<typename SubjectType>
+      concept member_begin = requires(SubjectType & subject) {
+        typename SubjectType::iterator;
+        {
+          subject.begin()
+        } -> std::same_as<typename SubjectType::iterator>;
+      };
+
+      template<typename SubjectType>
+      concept const_member_begin = requires(SubjectType const & subject) {
+        typename SubjectType::const_iterator;
+        {
+          subject.begin()
+        } -> std::same_as<typename SubjectType::const_iterator>;
+      };
+
+      template<typename SubjectType>
+      concept beginnable = free_begin<SubjectType> || member_begin<SubjectType>;
+
+      template<typename SubjectType>
+      concept const_beginnable = const_free_begin<SubjectType> || const_member_begin<SubjectType>;
+
+      template<typename SubjectType>
+      concept free_cbegin = requires(SubjectType const & subject) {
+        typename SubjectType::const_iterator;
+        {
+          cbegin(subject)
+        } -> std::same_as<typename SubjectType::const_iterator>;
+      };
+
+      template<typename SubjectType>
+      concept member_cbegin = requires(SubjectType const & subject) {
+        typename SubjectType::const_iterator;
+        {
+          subject.cbegin()
+        } -> std::same_as<typename SubjectType::const_iterator>;
+      };
+
+      template<typename SubjectType>
+      concept cbeginnable = free_cbegin<SubjectType> || member_cbegin<SubjectType>;
+
+      template<typename SubjectType>
+      concept free_rbegin = requires(SubjectType & subject) {
+        typename SubjectType::reverse_iterator;
+        {
+          rbegin(subject)
+        } -> std::same_as<typename SubjectType::reverse_iterator>;
+      };
+
+      template<typename SubjectType>
+      concept const_free_rbegin = requires(SubjectType const & subject) {
+        typename SubjectType::const_reverse_iterator;
+        {
+          rbegin(subject)
+        } -> std::same_as<typename SubjectType::const_reverse_iterator>;
+      };
+
+      template<typename SubjectType>
+      concept member_rbegin = requires(SubjectType & subject) {
+        typename SubjectType::reverse_iterator;
+        {
+          subject.rbegin()
+        } -> std::same_as<typename SubjectType::reverse_iterator>;
+      };
+
+      template<typename SubjectType>
+      concept const_member_rbegin = requires(SubjectType const & subject) {
+        typename SubjectType::const_reverse_iterator;
+        {
+          subject.rbegin()
+        } -> std::same_as<typename SubjectType::const_reverse_iterator>;
+      };
+
+      template<typename SubjectType>
+      concept rbeginnable = free_rbegin<SubjectType> || member_rbegin<SubjectType>;
+
+      template<typename SubjectType>
+      concept const_rbeginnable = const_free_rbegin<SubjectType> || const_member_rbegin<SubjectType>;
+
+      template<typename SubjectType>
+      concept free_crbegin = requires(SubjectType const & subject) {
+        typename SubjectType::const_reverse_iterator;
+        {
+          crbegin(subject)
+        } -> std::same_as<typename SubjectType::const_reverse_iterator>;
+      };
+
+      template<typename SubjectType>
+      concept member_crbegin = requires(SubjectType const & subject) {
+        typename SubjectType::const_reverse_iterator;
+        {
+          subject.crbegin()
+        } -> std::same_as<typename SubjectType::const_reverse_iterator>;
+      };
+
+      template<typename SubjectType>
+      concept crbeginnable = free_crbegin<SubjectType> || member_crbegin<SubjectType>;
+
+      template<typename SubjectType>
+      concept free_end = requires(SubjectType & subject) {
+        typename SubjectType::iterator;
+        {
+          end(subject)
+        } -> std::same_as<typename SubjectType::iterator>;
+      };
+
+      template<typename SubjectType>
+      concept const_free_end = requires(SubjectType const & subject) {
+        typename SubjectType::const_iterator;
+        {
+          end(subject)
+        } -> std::same_as<typename SubjectType::const_iterator>;
+      };
+
+      template<typename SubjectType>
+      concept member_end = requires(SubjectType & subject) {
+        typename SubjectType::iterator;
+        {
+          subject.end()
+        } -> std::same_as<typename SubjectType::iterator>;
+      };
+
+      template<typename SubjectType>
+      concept const_member_end = requires(SubjectType const & subject) {
+        typename SubjectType::const_iterator;
+        {
+          subject.end()
+        } -> std::same_as<typename SubjectType::const_iterator>;
+      };
+
+      template<typename SubjectType>
+      concept endable = free_end<SubjectType> || member_end<SubjectType>;
+
+      template<typename SubjectType>
+      concept const_endable = const_free_end<SubjectType> || const_member_end<SubjectType>;
+
+      template<typename SubjectType>
+      concept free_cend = requires(SubjectType const & subject) {
+        typename SubjectType::const_iterator;
+        {
+          cend(subject)
+        } -> std::same_as<typename SubjectType::const_iterator>;
+      };
+
+      template<typename SubjectType>
+      concept member_cend = requires(SubjectType const & subject) {
+        typename SubjectType::const_iterator;
+        {
+          subject.cend()
+        } -> std::same_as<typename SubjectType::const_iterator>;
+      };
+
+      template<typename SubjectType>
+      concept cendable = free_cend<SubjectType> || member_cend<SubjectType>;
+
+      template<typename SubjectType>
+      concept free_rend = requires(SubjectType & subject) {
+        typename SubjectType::reverse_iterator;
+        {
+          rend(subject)
+        } -> std::same_as<typename SubjectType::reverse_iterator>;
+      };
+
+      template<typename SubjectType>
+      concept const_free_rend = requires(SubjectType const & subject) {
+        typename SubjectType::const_reverse_iterator;
+        {
+          rend(subject)
+        } -> std::same_as<typename SubjectType::const_reverse_iterator>;
+      };
+
+      template<typename SubjectType>
+      concept member_rend = requires(SubjectType & subject) {
+        typename SubjectType::reverse_iterator;
+        {
+          subject.rend()
+        } -> std::same_as<typename SubjectType::reverse_iterator>;
+      };
+
+      template<typename SubjectType>
+      concept const_member_rend = requires(SubjectType const & subject) {
+        typename SubjectType::const_reverse_iterator;
+        {
+          subject.rend()
+        } -> std::same_as<typename SubjectType::const_reverse_iterator>;
+      };
+
+      template<typename SubjectType>
+      concept rendable = free_rend<SubjectType> || member_rend<SubjectType>;
+
+      template<typename SubjectType>
+      concept const_rendable = const_free_rend<SubjectType> || const_member_rend<SubjectType>;
+
+      template<typename SubjectType>
+      concept free_crend = requires(SubjectType const & subject) {
+        typename SubjectType::const_reverse_iterator;
+        {
+          crend(subject)
+        } -> std::same_as<typename SubjectType::const_reverse_iterator>;
+      };
+
+      template<typename SubjectType>
+      concept member_crend = requires(SubjectType const & subject) {
+        typename SubjectType::const_reverse_iterator;
+        {
+          subject.crend()
+        } -> std::same_as<typename SubjectType::const_reverse_iterator>;
+      };
+
+      template<typename SubjectType>
+      concept crendable = free_crend<SubjectType> || member_crend<SubjectType>;
+
+      template<typename SubjectType>
+      concept member_data = requires(SubjectType & subject) {
+        subject.data();
+        requires std::is_pointer_v<decltype(subject.data())>;
+      };
+
+      template<typename SubjectType>
+      concept const_member_data = requires(SubjectType const & subject) {
+        subject.data();
+        requires std::is_pointer_v<decltype(subject.data())>;
+      };
+
+      template<typename SubjectType>
+      concept member_size = requires(SubjectType const & subject) {
+        {
+          subject.size()
+        } -> std::integral;
+      };
+
+      template<typename SubjectType>
+      concept member_empty = requires(SubjectType const & subject) {
+        {
+          subject.empty()
+        } -> std::convertible_to<bool>;
+      };
+    }  // namespace iterable
+
+    inline namespace subscriptable
+    {
+
+      template<typename SubjectType, typename IndexType>
+      concept member_subscript = requires(SubjectType & subject, IndexType && index) { subject[std::forward<IndexType>(index)]; };
+
+      template<typename SubjectType, typename IndexType>
+      concept const_member_subscript = requires(SubjectType const & subject, IndexType && index) { subject[std::forward<IndexType>(index)]; };
+
+#if __cpp_multidimensional_subscript >= 202110L
+      template<typename SubjectType, typename... IndexTypes>
+      concept member_multidimensional_subscript =
+          requires(SubjectType & subject, IndexTypes &&... indices) { subject[std::forward<IndexTypes>(indices)...]; };
+
+      template<typename SubjectType, typename... IndexTypes>
+      concept const_member_multidimensional_subscript =
+          requires(SubjectType const & subject, IndexTypes &&... indices) { subject[std::forward<IndexTypes>(indices)...]; };
+#endif
+
+    }  // namespace subscriptable
+
+    inline namespace containers
+    {
+
+      template<typename SubjectType>
+      concept member_capacity = requires(SubjectType const & subject) {
+        {
+          subject.capacity()
+        } -> std::integral;
+      };
+
+      template<typename SubjectType>
+      concept member_reserve = requires(SubjectType & subject, typename SubjectType::size_type capacity) { subject.reserve(capacity); };
+
+      template<typename SubjectType>
+      concept member_clear = requires(SubjectType & subject) { subject.clear(); };
+
+      template<typename SubjectType>
+      concept member_resize = requires(SubjectType & subject, typename SubjectType::size_type count) { subject.resize(count); };
+
+      template<typename SubjectType>
+      concept member_resize_with_value = requires(SubjectType & subject,
+                                                  typename SubjectType::size_type count,
+                                                  typename SubjectType::value_type const & value) { subject.resize(count, value); };
+
+      template<typename SubjectType>
+      concept member_copy_push_back =
+          requires(SubjectType & subject, typename SubjectType::value_type const & value) { subject.push_back(value); };
+
+      template<typename SubjectType>
+      concept member_move_push_back =
+          requires(SubjectType & subject, typename SubjectType::value_type && value) { subject.push_back(std::move(value)); };
+
+      template<typename SubjectType, typename... ArgumentTypes>
+      concept member_emplace_back =
+          requires(SubjectType & subject, ArgumentTypes &&... arguments) { subject.emplace_back(std::forward<ArgumentTypes>(arguments)...); };
+
+    }  // namespace containers
+
+  }  // namespace concepts
+
+  template<typename BaseType, typename TagType, auto DerivationClause = deriving()>
+  class new_type
+      : impl::new_type_move_assignment<BaseType, TagType, DerivationClause>
+      , public impl::new_type_iterator_types<BaseType, nt::derives<decltype(DerivationClause), nt::Iterable>>
+      , public impl::new_type_difference_type<BaseType, nt::derives<decltype(DerivationClause), nt::Index>>
+      , public impl::new_type_allocator_type<BaseType>
+  {
+    static_assert(!std::is_reference_v<BaseType>, "The base type must not be a reference type");
+    static_assert(!std::is_void_v<std::remove_cv_t<BaseType>>, "The base type must not be possibly cv-qualified void");
+
+    friend struct impl::new_type_access;
+
+    using super = impl::new_type_move_assignment<BaseType, TagType, DerivationClause>;
+
+  public:
+    using base_type = BaseType;
+    using tag_type = TagType;
+    using derivation_clause_type = decltype(DerivationClause);
+
+    auto constexpr static derivation_clause = DerivationClause;
+
+    using super::super;
+
+    constexpr new_type() noexcept(std::is_nothrow_default_constructible_v<BaseType>) = default;
+    constexpr new_type(new_type const &) noexcept(std::is_nothrow_copy_constructible_v<BaseType>) = default;
+    constexpr new_type(new_type &&) noexcept(std::is_nothrow_move_constructible_v<BaseType>) = default;
+
+    template<typename AllocatorArgType, typename AllocatorType>
+      requires(impl::uses_allocator_constructible<BaseType, AllocatorArgType, AllocatorType, BaseType const &> &&
+               !nt::derives<decltype(DerivationClause), nt::MoveOnly> && !nt::derives<decltype(DerivationClause), nt::Accounted>)
+    constexpr new_type(AllocatorArgType tag, AllocatorType const & allocator, new_type const & other)
+        : super(tag, allocator, other.m_value)
+    {
+      impl::audit_copy<TagType>(other.m_value);
+    }
+
+    template<typename AllocatorArgType, typename AllocatorType>
+      requires(impl::uses_allocator_constructible<BaseType, AllocatorArgType, AllocatorType, BaseType &&> &&
+               !nt::derives<decltype(DerivationClause), nt::Accounted>)
+    constexpr new_type(AllocatorArgType tag, AllocatorType const & allocator, new_type && other)
+        : super(tag, allocator, std::move(other.m_value))
+    {
+    }
+
+    auto constexpr operator=(new_type const &) noexcept(std::is_nothrow_copy_assignable_v<BaseType>) -> new_type & = default;
+    auto constexpr operator=(new_type &&) noexcept(std::is_nothrow_move_assignable_v<BaseType>) -> new_type & = default;
+
+    template<typename DerivationClauseT = decltype(DerivationClause)>
+      requires(!nt::derives<DerivationClauseT, nt::MoveOnly>)
+    auto constexpr decay() const & noexcept(std::is_nothrow_copy_constructible_v<BaseType>) -> BaseType
+    {
+      impl::audit_copy<TagType>(this->m_value);
+      return this->m_value;
+    }
+
+    auto constexpr decay() && noexcept(std::is_nothrow_move_constructible_v<BaseType>) -> BaseType
+    {
+      return std::move(this->m_value);
+    }
+
+    template<typename DerivationClauseT = decltype(DerivationClause)>
+      requires(nt::derives<DerivationClauseT, nt::MoveOnly> && std::copy_constructible<BaseType>)
+    auto constexpr clone() const noexcept(std::is_nothrow_copy_constructible_v<BaseType>) -> new_type
+    {
+      return new_type{std::in_place, this->m_value};
+    }
+
+    template<typename DerivationClauseT = decltype(DerivationClause)>
+    constexpr operator base_type() const & noexcept(std::is_nothrow_copy_constructible_v<base_type>)
+      requires(nt::derives<DerivationClauseT, nt::ImplicitConversion> && !nt::derives<DerivationClauseT, nt::MoveOnly>)
+    {
+      return decay();
+    }
+
+    template<typename DerivationClauseT = decltype(DerivationClause)>
+    explicit constexpr operator base_type() const & noexcept(std::is_nothrow_copy_constructible_v<base_type>)
+      requires(!nt::derives<DerivationClauseT, nt::ImplicitConversion> && !nt::derives<DerivationClauseT, nt::MoveOnly>)
+    {
+      return decay();
+    }
+
+    template<typename DerivationClauseT = decltype(DerivationClause)>
+    constexpr operator base_type() && noexcept(noexcept(std::declval<new_type &&>().decay()))
+      requires(nt::derives<DerivationClauseT, nt::ImplicitConversion>)
+    {
+      return std::move(*this).decay();
+    }
+
+    template<typename DerivationClauseT = decltype(DerivationClause)>
+    explicit constexpr operator base_type() && noexcept(noexcept(std::declval<new_type &&>().decay()))
+      requires(!nt::derives<DerivationClauseT, nt::ImplicitConversion>)
+    {
+      return std::move(*this).decay();
+    }
+
+    template<typename DerivationClauseT = decltype(DerivationClause)>
+      requires(nt::derives<DerivationClauseT, nt::Indirection> && !nt::derives<DerivationClauseT, nt::CachedHash>)
+    auto constexpr operator->() noexcept -> BaseType *
+    {
+      return __builtin_addressof(this->m_value);
+    }
+
+    template<typename DerivationClauseT = decltype(DerivationClause)>
+      requires(nt::derives<DerivationClauseT, nt::Indirection>)
+    auto constexpr operator->() const noexcept -> BaseType const *
+    {
+      return __builtin_addressof(this->m_value);
+    }
+
+    template<nt::concepts::member_begin BaseTypeT = BaseType, nt::derives<nt::Iterable> auto DerivationClauseV = DerivationClause>
+      requires(!nt::derives<decltype(DerivationClauseV), nt::CachedHash>)
+    auto constexpr begin() -> typename new_type<BaseTypeT, TagType, DerivationClauseV>::iterator
+    {
+      return this->m_value.begin();
+    }
+
+    template<nt::concepts::const_member_begin BaseTypeT = BaseType, nt::derives<nt::Iterable> auto DerivationClauseV = DerivationClause>
+    auto constexpr begin() const -> typename new_type<BaseTypeT, TagType, DerivationClauseV>::const_iterator
+    {
+      return this->m_value.begin();
+    }
+
+    template<nt::concepts::member_cbegin BaseTypeT = BaseType, nt::derives<nt::Iterable> auto DerivationClauseV = DerivationClause>
+    auto constexpr cbegin() const -> typename new_type<BaseTypeT, TagType, DerivationClauseV>::const_iterator
+    {
+      return this->m_value.cbegin();
+    }
+
+    template<nt::concepts::member_rbegin BaseTypeT = BaseType, nt::derives<nt::Iterable> auto DerivationClauseV = DerivationClause>
+      requires(!nt::derives<decltype(DerivationClauseV), nt::CachedHash>)
+    auto constexpr rbegin() -> typename new_type<BaseTypeT, TagType, DerivationClauseV>::reverse_iterator
+    {
+      return this->m_value.rbegin();
+    }
+
+    template<nt::concepts::const_member_rbegin BaseTypeT = BaseType, nt::derives<nt::Iterable> auto DerivationClauseV = DerivationClause>
+    auto constexpr rbegin() const -> typename new_type<BaseTypeT, TagType, DerivationClauseV>::const_reverse_iterator
+    {
+      return this->m_value.rbegin();
+    }
+
+    template<nt::concepts::member_crbegin BaseTypeT = BaseType, nt::derives<nt::Iterable> auto DerivationClauseV = DerivationClause>
+    auto constexpr crbegin() const -> typename new_type<BaseTypeT, TagType, DerivationClauseV>::const_reverse_iterator
+    {
+      return this->m_value.crbegin();
+    }
+
+    template<nt::concepts::member_end BaseTypeT = BaseType, nt::derives<nt::Iterable> auto DerivationClauseV = DerivationClause>
+      requires(!nt::derives<decltype(DerivationClauseV), nt::CachedHash>)
+    auto constexpr end() -> typename new_type<BaseTypeT, TagType, DerivationClauseV>::iterator
+    {
+      return this->m_value.end();
+    }
+
+    template<nt::concepts::const_member_end BaseTypeT = BaseType, nt::derives<nt::Iterable> auto DerivationClauseV = DerivationClause>
+    auto constexpr end() const -> typename new_type<BaseTypeT, TagType, DerivationClauseV>::const_iterator
+    {
+      return this->m_value.end();
+    }
+
+    template<nt::concepts::member_cend BaseTypeT = BaseType, nt::derives<nt::Iterable> auto DerivationClauseV = DerivationClause>
+    auto constexpr cend() const -> typename new_type<BaseTypeT, TagType, DerivationClauseV>::const_iterator
+    {
+      return this->m_value.cend();
+    }
+
+    template<nt::concepts::member_rend BaseTypeT = BaseType, nt::derives<nt::Iterable> auto DerivationClauseV = DerivationClause>
+      requires(!nt::derives<decltype(DerivationClauseV), nt::CachedHash>)
+    auto constexpr rend() -> typename new_type<BaseTypeT, TagType, DerivationClauseV>::reverse_iterator
+    {
+      return this->m_value.rend();
+    }
+
+    template<nt::concepts::const_member_rend BaseTypeT = BaseType, nt::derives<nt::Iterable> auto DerivationClauseV = DerivationClause>
+    auto constexpr rend() const -> typename new_type<BaseTypeT, TagType, DerivationClauseV>::const_reverse_iterator
+    {
+      return this->m_value.rend();
+    }
+
+    template<nt::concepts::member_crend BaseTypeT = BaseType, nt::derives<nt::Iterable> auto DerivationClauseV = DerivationClause>
+    auto constexpr crend() const -> typename new_type<BaseTypeT, TagType, DerivationClauseV>::const_reverse_iterator
+    {
+      return this->m_value.crend();
+    }
+
+    template<nt::concepts::member_data BaseTypeT = BaseType, nt::derives<nt::Iterable> auto DerivationClauseV = DerivationClause>
+      requires(!nt::derives<decltype(DerivationClauseV), nt::CachedHash>)
+    auto constexpr data() noexcept(noexcept(std::declval<BaseTypeT &>().data())) -> decltype(std::declval<BaseTypeT &>().data())
+    {
+      return this->m_value.data();
+    }
+
+    template<nt::concepts::const_member_data BaseTypeT = BaseType, nt::derives<nt::Iterable> auto DerivationClauseV = DerivationClause>
+    auto constexpr data() const noexcept(noexcept(std::declval<BaseTypeT const &>().data()))
+        -> decltype(std::declval<BaseTypeT const &>().data())
+    {
+      return this->m_value.data();
+    }
+
+    template<nt::concepts::member_size BaseTypeT = BaseType, typename DerivationClauseT = decltype(DerivationClause)>
+      requires(nt::derives<DerivationClauseT, nt::Iterable> || nt::derives<DerivationClauseT, nt::Container>)
+    auto constexpr size() const noexcept(noexcept(std::declval<BaseTypeT const &>().size()))
+        -> decltype(std::declval<BaseTypeT const &>().size())
+    {
+      return this->m_value.size();
+    }
+
+    template<nt::concepts::member_empty BaseTypeT = BaseType, typename DerivationClauseT = decltype(DerivationClause)>
+      requires(nt::derives<DerivationClauseT, nt::Iterable> || nt::derives<DerivationClauseT, nt::Container>)
+    auto constexpr empty() const noexcept(noexcept(std::declval<BaseTypeT const &>().empty())) -> bool
+    {
+      return this->m_value.empty();
+    }
+
+    template<nt::concepts::member_capacity BaseTypeT = BaseType, nt::derives<nt::Container> auto DerivationClauseV = DerivationClause>
+    auto constexpr capacity() const noexcept(noexcept(std::declval<BaseTypeT const &>().capacity()))
+        -> decltype(std::declval<BaseTypeT const &>().capacity())
+    {
+      return this->m_value.capacity();
+    }
+
+    template<nt::concepts::member_reserve BaseTypeT = BaseType, nt::derives<nt::Container> auto DerivationClauseV = DerivationClause>
+    auto constexpr reserve(typename BaseTypeT::size_type capacity) -> void
+    {
+      this->m_value.reserve(capacity);
+    }
+
+    template<nt::concepts::member_clear BaseTypeT = BaseType, nt::derives<nt::Container> auto DerivationClauseV = DerivationClause>
+      requires(!nt::derives<decltype(DerivationClauseV), nt::CachedHash>)
+    auto constexpr clear() noexcept(noexcept(std::declval<BaseTypeT &>().clear())) -> void
+    {
+      this->m_value.clear();
+    }
+
+    template<nt::concepts::member_resize BaseTypeT = BaseType, nt::derives<nt::Container> auto DerivationClauseV = DerivationClause>
+      requires(!nt::derives<decltype(DerivationClauseV), nt::CachedHash>)
+    auto constexpr resize(typename BaseTypeT::size_type count) -> void
+    {
+      this->m_value.resize(count);
+    }
+
+    template<nt::concepts::member_resize_with_value BaseTypeT = BaseType,
+             nt::derives<nt::Container> auto DerivationClauseV = DerivationClause>
+      requires(!nt::derives<decltype(DerivationClauseV), nt::CachedHash>)
+    auto constexpr resize(typename BaseTypeT::size_type count, typename BaseTypeT::value_type const & value) -> void
+    {
+      this->m_value.resize(count, value);
+    }
+
+    template<nt::concepts::member_copy_push_back BaseTypeT = BaseType, nt::derives<nt::Container> auto DerivationClauseV = DerivationClause>
+      requires(!nt::derives<decltype(DerivationClauseV), nt::CachedHash>)
+    auto constexpr push_back(typename BaseTypeT::value_type const & value) -> void
+    {
+      this->m_value.push_back(value);
+    }
+
+    template<nt::concepts::member_move_push_back BaseTypeT = BaseType, nt::derives<nt::Container> auto DerivationClauseV = DerivationClause>
+      requires(!nt::derives<decltype(DerivationClauseV), nt::CachedHash>)
+    auto constexpr push_back(typename BaseTypeT::value_type && value) -> void
+    {
+      this->m_value.push_back(std::move(value));
+    }
+
+    template<typename... ArgumentTypes, typename DerivationClauseT = decltype(DerivationClause)>
+      requires(nt::concepts::member_emplace_back<BaseType, ArgumentTypes...> && nt::derives<DerivationClauseT, nt::Container> &&
+               !nt::derives<DerivationClauseT, nt::CachedHash>)
+    auto constexpr emplace_back(ArgumentTypes &&... arguments) -> decltype(auto)
+    {
+      return this->m_value.emplace_back(std::forward<ArgumentTypes>(arguments)...);
+    }
+
+    template<typename IndexType, typename DerivationClauseT = decltype(DerivationClause)>
+      requires(nt::concepts::member_subscript<BaseType, IndexType> && nt::derives<DerivationClauseT, nt::Subscript> &&
+               !nt::derives<DerivationClauseT, nt::CachedHash>)
+    auto constexpr operator[](IndexType && index) noexcept(noexcept(std::declval<BaseType &>()[std::declval<IndexType>()])) -> decltype(auto)
+    {
+      return this->m_value[std::forward<IndexType>(index)];
+    }
+
+    template<typename IndexType, typename DerivationClauseT = decltype(DerivationClause)>
+      requires(nt::concepts::const_member_subscript<BaseType, IndexType> && nt::derives<DerivationClauseT, nt::Subscript>)
+    auto constexpr operator[](IndexType && index) const noexcept(noexcept(std::declval<BaseType const &>()[std::declval<IndexType>()]))
+        -> decltype(auto)
+    {
+      return this->m_value[std::forward<IndexType>(index)];
+    }
+
+#if __cpp_multidimensional_subscript >= 202110L
+    template<typename... IndexTypes, typename DerivationClauseT = decltype(DerivationClause)>
+      requires(sizeof...(IndexTypes) != 1 && nt::concepts::member_multidimensional_subscript<BaseType, IndexTypes...> &&
+               nt::derives<DerivationClauseT, nt::Subscript> && !nt::derives<DerivationClauseT, nt::CachedHash>)
+    auto constexpr operator[](IndexTypes &&... indices) noexcept(noexcept(std::declval<BaseType &>()[std::declval<IndexTypes>()...]))
+        -> decltype(auto)
+    {
+      return this->m_value[std::forward<IndexTypes>(indices)...];
+    }
+
+    template<typename... IndexTypes, typename DerivationClauseT = decltype(DerivationClause)>
+      requires(sizeof...(IndexTypes) != 1 && nt::concepts::const_member_multidimensional_subscript<BaseType, IndexTypes...> &&
+               nt::derives<DerivationClauseT, nt::Subscript>)
+    auto constexpr operator[](IndexTypes &&... indices) const
+        noexcept(noexcept(std::declval<BaseType const &>()[std::declval<IndexTypes>()...])) -> decltype(auto)
+    {
+      return this->m_value[std::forward<IndexTypes>(indices)...];
+    }
+#endif
+  };
+
+  template<typename NewType, typename... ArgumentTypes>
+    requires std::constructible_from<NewType, std::in_place_t, ArgumentTypes...>
+  auto constexpr make(ArgumentTypes &&... arguments) noexcept(std::is_nothrow_constructible_v<NewType, std::in_place_t, ArgumentTypes...>)
+      -> NewType
+  {
+    return NewType(std::in_place, std::forward<ArgumentTypes>(arguments)...);
+  }
+
+  template<nt::concepts::equality_comparable BaseType, typename TagType, auto DerivationClause>
+  auto constexpr
+  operator==(new_type<BaseType, TagType, DerivationClause> const & lhs,
+             new_type<BaseType, TagType, DerivationClause> const & rhs) noexcept(nt::concepts::nothrow_equality_comparable<BaseType>) -> bool
+  {
+    impl::record<TagType, DerivationClause>(impl::operation::comparison);
+    if constexpr (nt::derives<decltype(DerivationClause), nt::CachedHash>)
+    {
+      if (impl::new_type_access::hash(lhs) != impl::new_type_access::hash(rhs))
+      {
+        return false;
+      }
+    }
+    return impl::new_type_access::value(lhs) == impl::new_type_access::value(rhs);
+  }
+
+  template<nt::concepts::equality_comparable BaseType, typename TagType, nt::derives<nt::EqBase> auto DerivationClause>
+  auto constexpr operator==(new_type<BaseType, TagType, DerivationClause> const & lhs,
+                            BaseType const & rhs) noexcept(nt::concepts::nothrow_equality_comparable<BaseType>) -> bool
+  {
+    impl::record<TagType, DerivationClause>(impl::operation::comparison);
+    return impl::new_type_access::value(lhs) == rhs;
+  }
+
+  template<nt::concepts::equality_comparable BaseType, typename TagType, nt::derives<nt::EqBase> auto DerivationClause>
+  auto constexpr
+  operator==(BaseType const & lhs,
+             new_type<BaseType, TagType, DerivationClause> const & rhs) noexcept(nt::concepts::nothrow_equality_comparable<BaseType>) -> bool
+  {
+    impl::record<TagType, DerivationClause>(impl::operation::comparison);
+    return lhs == impl::new_type_access::value(rhs);
+  }
+
+  template<nt::concepts::inequality_comparable BaseType, typename TagType, auto DerivationClause>
+  auto constexpr
+  operator!=(new_type<BaseType, TagType, DerivationClause> const & lhs,
+             new_type<BaseType, TagType, DerivationClause> const & rhs) noexcept(nt::concepts::nothrow_inequality_comparable<BaseType>) -> bool
+  {
+    impl::record<TagType, DerivationClause>(impl::operation::comparison);
+    if constexpr (nt::derives<decltype(DerivationClause), nt::CachedHash>)
+    {
+      if (impl::new_type_access::hash(lhs) != impl::new_type_access::hash(rhs))
+      {
+        return true;
+      }
+    }
+    return impl::new_type_access::value(lhs) != impl::new_type_access::value(rhs);
+  }
+
+  template<nt::concepts::inequality_comparable BaseType, typename TagType, nt::derives<nt::EqBase> auto DerivationClause>
+  auto constexpr operator!=(new_type<BaseType, TagType, DerivationClause> const & lhs,
+                            BaseType const & rhs) noexcept(nt::concepts::nothrow_inequality_comparable<BaseType>) -> bool
+  {
+    impl::record<TagType, DerivationClause>(impl::operation::comparison);
+    return impl::new_type_access::value(lhs) != rhs;
+  }
+
+  template<nt::concepts::inequality_comparable BaseType, typename TagType, nt::derives<nt::EqBase> auto DerivationClause>
+  auto constexpr
+  operator!=(BaseType const & lhs,
+             new_type<BaseType, TagType, DerivationClause> const & rhs) noexcept(nt::concepts::nothrow_inequality_comparable<BaseType>) -> bool
+  {
+    impl::record<TagType, DerivationClause>(impl::operation::comparison);
+    return lhs != impl::new_type_access::value(rhs);
+  }
+
+  template<nt::concepts::less_than_comparable BaseType, typename TagType, nt::derives<nt::Relational> auto DerivationClause>
+  auto constexpr
+  operator<(new_type<BaseType, TagType, DerivationClause> const & lhs,
+            new_type<BaseType, TagType, DerivationClause> const & rhs) noexcept(nt::concepts::nothrow_less_than_comparable<BaseType>)
+  {
+    impl::record<TagType, DerivationClause>(impl::operation::comparison);
+    return impl::new_type_access::value(lhs) < impl::new_type_access::value(rhs);
+  }
+
+  template<nt::concepts::greater_than_comparable BaseType, typename TagType, nt::derives<nt::Relational> auto DerivationClause>
+  auto constexpr
+  operator>(new_type<BaseType, TagType, DerivationClause> const & lhs,
+            new_type<BaseType, TagType, DerivationClause> const & rhs) noexcept(nt::concepts::nothrow_greater_than_comparable<BaseType>)
+  {
+    impl::record<TagType, DerivationClause>(impl::operation::comparison);
+    return impl::new_type_access::value(lhs) > impl::new_type_access::value(rhs);
+  }
+
+  template<nt::concepts::less_than_equal_comparable BaseType, typename TagType, nt::derives<nt::Relational> auto DerivationClause>
+  auto constexpr
+  operator<=(new_type<BaseType, TagType, DerivationClause> const & lhs,
+             new_type<BaseType, TagType, DerivationClause> const & rhs) noexcept(nt::concepts::nothrow_less_than_equal_comparable<BaseType>)
+  {
+    impl::record<TagType, DerivationClause>(impl::operation::comparison);
+    return impl::new_type_access::value(lhs) <= impl::new_type_access::value(rhs);
+  }
+
+  template<nt::concepts::greater_than_equal_comparable BaseType, typename TagType, nt::derives<nt::Relational> auto DerivationClause>
+  auto constexpr
+  operator>=(new_type<BaseType, TagType, DerivationClause> const & lhs,
+             new_type<BaseType, TagType, DerivationClause> const & rhs) noexcept(nt::concepts::nothrow_greater_than_equal_comparable<BaseType>)
+  {
+    impl::record<TagType, DerivationClause>(impl::operation::comparison);
+    return impl::new_type_access::value(lhs) >= impl::new_type_access::value(rhs);
+  }
+
+  template<nt::concepts::addable BaseType, typename TagType, nt::derives<nt::Arithmetic> auto DerivationClause>
+  auto constexpr
+  operator+(new_type<BaseType, TagType, DerivationClause> const & lhs, new_type<BaseType, TagType, DerivationClause> const & rhs) noexcept(
+      nt::concepts::nothrow_addable<BaseType> && std::is_nothrow_move_constructible_v<BaseType>)
+      -> new_type<BaseType, TagType, DerivationClause>
+  {
+    impl::record<TagType, DerivationClause>(impl::operation::arithmetic);
+    return {impl::new_type_access::value(lhs) + impl::new_type_access::value(rhs)};
+  }
+
+  template<nt::concepts::compound_addable BaseType, typename TagType, nt::derives<nt::Arithmetic> auto DerivationClause>
+  auto constexpr
+  operator+=(new_type<BaseType, TagType, DerivationClause> & lhs,
+             new_type<BaseType, TagType, DerivationClause> const & rhs) noexcept(nt::concepts::nothrow_compound_addable<BaseType>)
+      -> new_type<BaseType, TagType, DerivationClause> &
+  {
+    impl::record<TagType, DerivationClause>(impl::operation::arithmetic);
+    impl::new_type_access::value(lhs) += impl::new_type_access::value(rhs);
+    impl::new_type_access::rehash(lhs);
+    return lhs;
+  }
+
+  template<nt::concepts::subtractable BaseType, typename TagType, nt::derives<nt::Arithmetic> auto DerivationClause>
+  auto constexpr
+  operator-(new_type<BaseType, TagType, DerivationClause> const & lhs, new_type<BaseType, TagType, DerivationClause> const & rhs) noexcept(
+      nt::concepts::nothrow_subtractable<BaseType> && std::is_nothrow_move_constructible_v<BaseType>)
+      -> new_type<BaseType, TagType, DerivationClause>
+  {
+    impl::record<TagType, DerivationClause>(impl::operation::arithmetic);
+    return {impl::new_type_access::value(lhs) - impl::new_type_access::value(rhs)};
+  }
+
+  template<nt::concepts::compound_subtractable BaseType, typename TagType, nt::derives<nt::Arithmetic> auto DerivationClause>
+  auto constexpr
+  operator-=(new_type<BaseType, TagType, DerivationClause> & lhs,
+             new_type<BaseType, TagType, DerivationClause> const & rhs) noexcept(nt::concepts::nothrow_compound_subtractable<BaseType>)
+      -> new_type<BaseType, TagType, DerivationClause> &
+  {
+    impl::record<TagType, DerivationClause>(impl::operation::arithmetic);
+    impl::new_type_access::value(lhs) -= impl::new_type_access::value(rhs);
+    impl::new_type_access::rehash(lhs);
+    return lhs;
+  }
+
+  template<nt::concepts::multipliable BaseType, typename TagType, nt::derives<nt::Arithmetic> auto DerivationClause>
+  auto constexpr
+  operator*(new_type<BaseType, TagType, DerivationClause> const & lhs, new_type<BaseType, TagType, DerivationClause> const & rhs) noexcept(
+      nt::concepts::nothrow_multipliable<BaseType> && std::is_nothrow_move_constructible_v<BaseType>)
+      -> new_type<BaseType, TagType, DerivationClause>
+  {
+    impl::record<TagType, DerivationClause>(impl::operation::arithmetic);
+    return {impl::new_type_access::value(lhs) * impl::new_type_access::value(rhs)};
+  }
+
+  template<nt::concepts::compound_multipliable BaseType, typename TagType, nt::derives<nt::Arithmetic> auto DerivationClause>
+  auto constexpr
+  operator*=(new_type<BaseType, TagType, DerivationClause> & lhs,
+             new_type<BaseType, TagType, DerivationClause> const & rhs) noexcept(nt::concepts::nothrow_compound_multipliable<BaseType>)
+      -> new_type<BaseType, TagType, DerivationClause> &
+  {
+    impl::record<TagType, DerivationClause>(impl::operation::arithmetic);
+    impl::new_type_access::value(lhs) *= impl::new_type_access::value(rhs);
+    impl::new_type_access::rehash(lhs);
+    return lhs;
+  }
+
+  template<nt::concepts::divisible BaseType, typename TagType, nt::derives<nt::Arithmetic> auto DerivationClause>
+  auto constexpr
+  operator/(new_type<BaseType, TagType, DerivationClause> const & lhs, new_type<BaseType, TagType, DerivationClause> const & rhs) noexcept(
+      nt::concepts::nothrow_divisible<BaseType> && std::is_nothrow_move_constructible_v<BaseType>)
+      -> new_type<BaseType, TagType, DerivationClause>
+  {
+    impl::record<TagType, DerivationClause>(impl::operation::arithmetic);
+    return {impl::new_type_access::value(lhs) / impl::new_type_access::value(rhs)};
+  }
+
+  template<nt::concepts::compound_divisible BaseType, typename TagType, nt::derives<nt::Arithmetic> auto DerivationClause>
+  auto constexpr
+  operator/=(new_type<BaseType, TagType, DerivationClause> & lhs,
+             new_type<BaseType, TagType, DerivationClause> const & rhs) noexcept(nt::concepts::nothrow_compound_divisible<BaseType>)
+      -> new_type<BaseType, TagType, DerivationClause> &
+  {
+    impl::record<TagType, DerivationClause>(impl::operation::arithmetic);
+    impl::new_type_access::value(lhs) /= impl::new_type_access::value(rhs);
+    impl::new_type_access::rehash(lhs);
+    return lhs;
+  }
+
+  template<nt::concepts::incrementable BaseType, typename TagType, nt::derives<nt::Index> auto DerivationClause>
+  auto constexpr operator++(new_type<BaseType, TagType, DerivationClause> & target) noexcept(nt::concepts::nothrow_incrementable<BaseType>)
+      -> new_type<BaseType, TagType, DerivationClause> &
+  {
+    impl::record<TagType, DerivationClause>(impl::operation::arithmetic);
+    ++impl::new_type_access::value(target);
+    impl::new_type_access::rehash(target);
+    return target;
+  }
+
+  template<nt::concepts::incrementable BaseType, typename TagType, nt::derives<nt::Index> auto DerivationClause>
+    requires(!nt::derives<decltype(DerivationClause), nt::MoveOnly>)
+  auto constexpr operator++(new_type<BaseType, TagType, DerivationClause> & target,
+                            int) noexcept(nt::concepts::nothrow_incrementable<BaseType> && std::is_nothrow_copy_constructible_v<BaseType>)
+      -> new_type<BaseType, TagType, DerivationClause>
+  {
+    auto previous = target;
+    ++target;
+    return previous;
+  }
+
+  template<nt::concepts::decrementable BaseType, typename TagType, nt::derives<nt::Index> auto DerivationClause>
+  auto constexpr operator--(new_type<BaseType, TagType, DerivationClause> & target) noexcept(nt::concepts::nothrow_decrementable<BaseType>)
+      -> new_type<BaseType, TagType, DerivationClause> &
+  {
+    impl::record<TagType, DerivationClause>(impl::operation::arithmetic);
+    --impl::new_type_access::value(target);
+    impl::new_type_access::rehash(target);
+    return target;
+  }
+
+  template<nt::concepts::decrementable BaseType, typename TagType, nt::derives<nt::Index> auto DerivationClause>
+    requires(!nt::derives<decltype(DerivationClause), nt::MoveOnly>)
+  auto constexpr operator--(new_type<BaseType, TagType, DerivationClause> & target,
+                            int) noexcept(nt::concepts::nothrow_decrementable<BaseType> && std::is_nothrow_copy_constructible_v<BaseType>)
+      -> new_type<BaseType, TagType, DerivationClause>
+  {
+    auto previous = target;
+    --target;
+    return previous;
+  }
+
+  template<nt::concepts::advanceable BaseType, typename TagType, nt::derives<nt::Index> auto DerivationClause>
+  auto constexpr operator+=(new_type<BaseType, TagType, DerivationClause> & lhs,
+                            impl::difference_type_of_t<BaseType> rhs) noexcept(nt::concepts::nothrow_advanceable<BaseType>)
+      -> new_type<BaseType, TagType, DerivationClause> &
+  {
+    impl::record<TagType, DerivationClause>(impl::operation::arithmetic);
+    impl::new_type_access::value(lhs) += rhs;
+    impl::new_type_access::rehash(lhs);
+    return lhs;
+  }
+
+  template<nt::concepts::advanceable BaseType, typename TagType, nt::derives<nt::Index> auto DerivationClause>
+  auto constexpr operator-=(new_type<BaseType, TagType, DerivationClause> & lhs,
+                            impl::difference_type_of_t<BaseType> rhs) noexcept(nt::concepts::nothrow_advanceable<BaseType>)
+      -> new_type<BaseType, TagType, DerivationClause> &
+  {
+    impl::record<TagType, DerivationClause>(impl::operation::arithmetic);
+    impl::new_type_access::value(lhs) -= rhs;
+    impl::new_type_access::rehash(lhs);
+    return lhs;
+  }
+
+  template<nt::concepts::advanceable BaseType, typename TagType, nt::derives<nt::Index> auto DerivationClause>
+    requires(!nt::derives<decltype(DerivationClause), nt::MoveOnly>)
+  auto constexpr operator+(new_type<BaseType, TagType, DerivationClause> const & lhs, impl::difference_type_of_t<BaseType> rhs) noexcept(
+      nt::concepts::nothrow_advanceable<BaseType> && std::is_nothrow_copy_constructible_v<BaseType>)
+      -> new_type<BaseType, TagType, DerivationClause>
+  {
+    auto result = lhs;
+    return result += rhs;
+  }
+
+  template<nt::concepts::advanceable BaseType, typename TagType, nt::derives<nt::Index> auto DerivationClause>
+    requires(!nt::derives<decltype(DerivationClause), nt::MoveOnly>)
+  auto constexpr operator+(impl::difference_type_of_t<BaseType> lhs, new_type<BaseType, TagType, DerivationClause> const & rhs) noexcept(
+      nt::concepts::nothrow_advanceable<BaseType> && std::is_nothrow_copy_constructible_v<BaseType>)
+      -> new_type<BaseType, TagType, DerivationClause>
+  {
+    auto result = rhs;
+    return result += lhs;
+  }
+
+  template<nt::concepts::advanceable BaseType, typename TagType, nt::derives<nt::Index> auto DerivationClause>
+    requires(!nt::derives<decltype(DerivationClause), nt::MoveOnly>)
+  auto constexpr operator-(new_type<BaseType, TagType, DerivationClause> const & lhs, impl::difference_type_of_t<BaseType> rhs) noexcept(
+      nt::concepts::nothrow_advanceable<BaseType> && std::is_nothrow_copy_constructible_v<BaseType>)
+      -> new_type<BaseType, TagType, DerivationClause>
+  {
+    auto result = lhs;
+    return result -= rhs;
+  }
+
+  template<nt::concepts::advanceable BaseType, typename TagType, nt::derives<nt::Index> auto DerivationClause>
+    requires(!nt::derives<decltype(DerivationClause), nt::Arithmetic>)
+  auto constexpr operator-(new_type<BaseType, TagType, DerivationClause> const & lhs,
+                           new_type<BaseType, TagType, DerivationClause> const & rhs) noexcept(nt::concepts::nothrow_subtractable<BaseType>)
+      -> impl::difference_type_of_t<BaseType>
+  {
+    impl::record<TagType, DerivationClause>(impl::operation::arithmetic);
+    return static_cast<impl::difference_type_of_t<BaseType>>(impl::new_type_access::value(lhs) - impl::new_type_access::value(rhs));
+  }
+
+}  // namespace nt
+
+#endif
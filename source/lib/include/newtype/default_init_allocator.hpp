@@ -0,0 +1,56 @@
+#ifndef NEWTYPE_DEFAULT_INIT_ALLOCATOR_HPP
+#define NEWTYPE_DEFAULT_INIT_ALLOCATOR_HPP
+
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace nt
+{
+
+  template<typename ValueType, typename Allocator = std::allocator<ValueType>>
+  class default_init_allocator : public Allocator
+  {
+    using traits = std::allocator_traits<Allocator>;
+
+    static_assert(std::is_same_v<ValueType, typename traits::value_type>, "The allocator must allocate objects of the value type");
+
+  public:
+    template<typename OtherValueType>
+    struct rebind
+    {
+      using other = default_init_allocator<OtherValueType, typename traits::template rebind_alloc<OtherValueType>>;
+    };
+
+    using Allocator::Allocator;
+
+    constexpr default_init_allocator() noexcept(std::is_nothrow_default_constructible_v<Allocator>) = default;
+
+    constexpr default_init_allocator(Allocator const & allocator) noexcept(std::is_nothrow_copy_constructible_v<Allocator>)
+        : Allocator(allocator)
+    {
+    }
+
+    template<typename OtherValueType, typename OtherAllocator>
+    constexpr default_init_allocator(default_init_allocator<OtherValueType, OtherAllocator> const & other) noexcept
+        : Allocator(static_cast<OtherAllocator const &>(other))
+    {
+    }
+
+    template<typename ObjectType>
+    auto construct(ObjectType * object) noexcept(std::is_nothrow_default_constructible_v<ObjectType>) -> void
+    {
+      ::new (static_cast<void *>(object)) ObjectType;
+    }
+
+    template<typename ObjectType, typename... ArgumentTypes>
+    auto construct(ObjectType * object, ArgumentTypes &&... arguments) -> void
+    {
+      traits::construct(static_cast<Allocator &>(*this), object, std::forward<ArgumentTypes>(arguments)...);
+    }
+  };
+
+}  // namespace nt
+
+#endif
@@ -0,0 +1,34 @@
+#ifndef NEWTYPE_DERIVABLE_ORDER_HPP
+#define NEWTYPE_DERIVABLE_ORDER_HPP
+
+#include "newtype/core.hpp"
+
+#include <source_location>
+
+namespace nt
+{
+
+  namespace impl
+  {
+
+    inline namespace canonicalization
+    {
+
+      template<typename DerivableTag>
+      struct derivable_name
+      {
+        auto constexpr static name() noexcept -> char const *
+        {
+          return std::source_location::current().function_name();
+        }
+
+        auto constexpr static value = name();
+      };
+
+    }  // namespace canonicalization
+
+  }  // namespace impl
+
+}  // namespace nt
+
+#endif
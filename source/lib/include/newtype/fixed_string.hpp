@@ -0,0 +1,182 @@
+#ifndef NEWTYPE_FIXED_STRING_HPP
+#define NEWTYPE_FIXED_STRING_HPP
+
+#include <algorithm>
+#include <array>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <istream>
+#include <limits>
+#include <locale>
+#include <ostream>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+
+#if __has_include(<format>)
+#include <format>
+#endif
+
+namespace nt
+{
+
+  namespace impl
+  {
+
+    template<std::size_t Capacity>
+    using fixed_string_size_type =
+        std::conditional_t<Capacity <= std::numeric_limits<std::uint8_t>::max(),
+                           std::uint8_t,
+                           std::conditional_t<Capacity <= std::numeric_limits<std::uint16_t>::max(), std::uint16_t, std::size_t>>;
+
+  }  // namespace impl
+
+  template<std::size_t Capacity>
+  class fixed_string
+  {
+  public:
+    using value_type = char;
+    using size_type = std::size_t;
+    using const_iterator = char const *;
+    using iterator = const_iterator;
+
+    constexpr fixed_string() noexcept = default;
+
+    template<std::size_t Size>
+      requires(Size > 0 && Size - 1 <= Capacity)
+    consteval fixed_string(char const (&literal)[Size]) noexcept
+        : m_size{static_cast<impl::fixed_string_size_type<Capacity>>(Size - 1)}
+    {
+      std::copy_n(literal, Size - 1, m_data.begin());
+    }
+
+    explicit constexpr fixed_string(std::string_view value)
+    {
+      if (value.size() > Capacity)
+      {
+        throw std::length_error{"nt::fixed_string: value exceeds capacity"};
+      }
+      std::copy(value.begin(), value.end(), m_data.begin());
+      m_size = static_cast<impl::fixed_string_size_type<Capacity>>(value.size());
+    }
+
+    auto constexpr view() const noexcept -> std::string_view
+    {
+      return {m_data.data(), m_size};
+    }
+
+    constexpr operator std::string_view() const noexcept
+    {
+      return view();
+    }
+
+    auto constexpr data() const noexcept -> char const *
+    {
+      return m_data.data();
+    }
+
+    auto constexpr size() const noexcept -> size_type
+    {
+      return m_size;
+    }
+
+    auto constexpr empty() const noexcept -> bool
+    {
+      return m_size == 0;
+    }
+
+    auto constexpr static capacity() noexcept -> size_type
+    {
+      return Capacity;
+    }
+
+    auto constexpr begin() const noexcept -> const_iterator
+    {
+      return m_data.data();
+    }
+
+    auto constexpr end() const noexcept -> const_iterator
+    {
+      return m_data.data() + m_size;
+    }
+
+    auto constexpr operator[](size_type index) const noexcept -> char
+    {
+      return m_data[index];
+    }
+
+    auto constexpr operator==(fixed_string const & other) const noexcept -> bool
+    {
+      return m_size == other.m_size && m_data == other.m_data;
+    }
+
+    auto constexpr operator<=>(fixed_string const & other) const noexcept -> std::strong_ordering
+    {
+      return view() <=> other.view();
+    }
+
+  private:
+    std::array<char, Capacity> m_data{};
+    impl::fixed_string_size_type<Capacity> m_size{};
+  };
+
+  template<std::size_t Size>
+  fixed_string(char const (&)[Size]) -> fixed_string<Size - 1>;
+
+  template<std::size_t Capacity, typename StreamTraits>
+  auto operator<<(std::basic_ostream<char, StreamTraits> & output, fixed_string<Capacity> const & value)
+      -> std::basic_ostream<char, StreamTraits> &
+  {
+    return output << value.view();
+  }
+
+  template<std::size_t Capacity, typename StreamTraits>
+  auto operator>>(std::basic_istream<char, StreamTraits> & input, fixed_string<Capacity> & target) -> std::basic_istream<char, StreamTraits> &
+  {
+    char buffer[Capacity + 1]{};
+    if (!(input >> buffer))
+    {
+      return input;
+    }
+
+    auto next = input.peek();
+    if (!StreamTraits::eq_int_type(next, StreamTraits::eof()) && !std::isspace(StreamTraits::to_char_type(next), input.getloc()))
+    {
+      input.setstate(std::ios_base::failbit);
+      return input;
+    }
+
+    target = fixed_string<Capacity>{std::string_view{buffer}};
+    return input;
+  }
+
+}  // namespace nt
+
+namespace std
+{
+
+  template<std::size_t Capacity>
+  struct hash<nt::fixed_string<Capacity>>
+  {
+    auto constexpr operator()(nt::fixed_string<Capacity> const & value) const noexcept -> std::size_t
+    {
+      return std::hash<std::string_view>{}(value.view());
+    }
+  };
+
+#if __cpp_lib_format >= 201907L
+  template<std::size_t Capacity>
+  struct formatter<nt::fixed_string<Capacity>> : formatter<std::string_view>
+  {
+    auto format(nt::fixed_string<Capacity> const & value, auto & context) const
+    {
+      return formatter<std::string_view>::format(value.view(), context);
+    }
+  };
+#endif
+
+}  // namespace std
+
+#endif
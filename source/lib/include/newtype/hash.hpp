@@ -0,0 +1,90 @@
+#ifndef NEWTYPE_HASH_HPP
+#define NEWTYPE_HASH_HPP
+
+#include "newtype/core.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+namespace nt
+{
+
+  namespace concepts
+  {
+
+    inline namespace standard_extensions
+    {
+
+      template<typename SubjectType>
+      concept hashable = requires(SubjectType subject) {
+        {
+          std::hash<SubjectType>{}(subject)
+        } -> std::convertible_to<std::size_t>;
+      };
+
+    }  // namespace standard_extensions
+
+  }  // namespace concepts
+
+  namespace impl
+  {
+
+    inline namespace storage
+    {
+
+      template<typename BaseType>
+      concept nothrow_hashable = noexcept(std::hash<BaseType>{}(std::declval<BaseType const &>()));
+
+      template<typename BaseType, typename TagType, auto DerivationClause>
+      struct new_type_hash_cache<BaseType, TagType, DerivationClause, true> : new_type_storage<BaseType, TagType, DerivationClause>
+      {
+        static_assert(std::is_default_constructible_v<std::hash<BaseType>>, "The base type must be hashable to derive nt::CachedHash");
+        static_assert(!nt::derives<decltype(DerivationClause), nt::DefaultInit>, "nt::CachedHash cannot be combined with nt::DefaultInit");
+
+        using new_type_storage<BaseType, TagType, DerivationClause>::new_type_storage;
+
+        constexpr new_type_hash_cache() = default;
+        constexpr new_type_hash_cache(new_type_hash_cache const &) = default;
+        constexpr new_type_hash_cache(new_type_hash_cache &&) = default;
+
+        auto constexpr operator=(new_type_hash_cache const &) -> new_type_hash_cache & = default;
+        auto constexpr operator=(new_type_hash_cache &&) -> new_type_hash_cache & = default;
+
+        auto constexpr rehash() noexcept(nothrow_hashable<BaseType>) -> void
+        {
+          m_hash = std::hash<BaseType>{}(this->m_value);
+        }
+
+        std::size_t m_hash{std::hash<BaseType>{}(this->m_value)};
+      };
+
+    }  // namespace storage
+
+  }  // namespace impl
+
+}  // namespace nt
+
+namespace std
+{
+  template<nt::concepts::hashable BaseType, typename TagType, auto DerivationClause>
+    requires(nt::derives<decltype(DerivationClause), nt::Hash> || nt::derives<decltype(DerivationClause), nt::CachedHash>)
+  struct hash<nt::new_type<BaseType, TagType, DerivationClause>>
+  {
+    auto constexpr operator()(nt::new_type<BaseType, TagType, DerivationClause> const & object) const -> std::size_t
+    {
+      nt::impl::record<TagType, DerivationClause>(nt::impl::operation::hash);
+      if constexpr (nt::derives<decltype(DerivationClause), nt::CachedHash>)
+      {
+        return nt::impl::new_type_access::hash(object);
+      }
+      else
+      {
+        return std::hash<BaseType>{}(nt::impl::new_type_access::value(object));
+      }
+    }
+  };
+}  // namespace std
+
+#endif
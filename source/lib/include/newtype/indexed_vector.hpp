@@ -0,0 +1,284 @@
+#ifndef NEWTYPE_INDEXED_VECTOR_HPP
+#define NEWTYPE_INDEXED_VECTOR_HPP
+
+#include "newtype/core.hpp"
+
+#include <concepts>
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace nt
+{
+
+  namespace concepts
+  {
+
+    inline namespace indexing
+    {
+
+      template<typename SubjectType>
+      concept strong_index = requires {
+        typename SubjectType::base_type;
+        typename SubjectType::tag_type;
+        typename SubjectType::derivation_clause_type;
+        requires std::same_as<SubjectType,
+                              nt::new_type<typename SubjectType::base_type, typename SubjectType::tag_type, SubjectType::derivation_clause>>;
+        requires nt::derives<typename SubjectType::derivation_clause_type, nt::Index>;
+        requires std::integral<typename SubjectType::base_type>;
+      };
+
+    }  // namespace indexing
+
+  }  // namespace concepts
+
+  template<std::weakly_incrementable IndexType>
+    requires std::equality_comparable<IndexType>
+  auto constexpr indices(IndexType first, IndexType last) -> std::ranges::iota_view<IndexType, IndexType>
+  {
+    return std::ranges::iota_view<IndexType, IndexType>{std::move(first), std::move(last)};
+  }
+
+  template<nt::concepts::strong_index IndexType, typename ValueType, typename Allocator = std::allocator<ValueType>>
+  class indexed_vector
+  {
+    using container_type = std::vector<ValueType, Allocator>;
+
+  public:
+    using index_type = IndexType;
+    using value_type = typename container_type::value_type;
+    using allocator_type = typename container_type::allocator_type;
+    using size_type = typename container_type::size_type;
+    using difference_type = typename container_type::difference_type;
+    using reference = typename container_type::reference;
+    using const_reference = typename container_type::const_reference;
+    using pointer = typename container_type::pointer;
+    using const_pointer = typename container_type::const_pointer;
+    using iterator = typename container_type::iterator;
+    using const_iterator = typename container_type::const_iterator;
+    using reverse_iterator = typename container_type::reverse_iterator;
+    using const_reverse_iterator = typename container_type::const_reverse_iterator;
+
+    constexpr indexed_vector() noexcept(std::is_nothrow_default_constructible_v<container_type>) = default;
+
+    explicit constexpr indexed_vector(allocator_type const & allocator) noexcept
+        : m_data(allocator)
+    {
+    }
+
+    explicit constexpr indexed_vector(size_type count, allocator_type const & allocator = allocator_type{})
+        : m_data(count, allocator)
+    {
+    }
+
+    constexpr indexed_vector(size_type count, value_type const & value, allocator_type const & allocator = allocator_type{})
+        : m_data(count, value, allocator)
+    {
+    }
+
+    constexpr indexed_vector(std::initializer_list<value_type> values, allocator_type const & allocator = allocator_type{})
+        : m_data(values, allocator)
+    {
+    }
+
+    explicit constexpr indexed_vector(container_type data) noexcept
+        : m_data(std::move(data))
+    {
+    }
+
+    auto constexpr operator[](index_type index) noexcept -> reference
+    {
+      return m_data[static_cast<size_type>(index.decay())];
+    }
+
+    auto constexpr operator[](index_type index) const noexcept -> const_reference
+    {
+      return m_data[static_cast<size_type>(index.decay())];
+    }
+
+    template<typename OtherIndexType>
+    auto operator[](OtherIndexType) -> reference = delete;
+
+    template<typename OtherIndexType>
+    auto operator[](OtherIndexType) const -> const_reference = delete;
+
+    auto constexpr at(index_type index) -> reference
+    {
+      return m_data.at(static_cast<size_type>(index.decay()));
+    }
+
+    auto constexpr at(index_type index) const -> const_reference
+    {
+      return m_data.at(static_cast<size_type>(index.decay()));
+    }
+
+    auto constexpr front() -> reference
+    {
+      return m_data.front();
+    }
+
+    auto constexpr front() const -> const_reference
+    {
+      return m_data.front();
+    }
+
+    auto constexpr back() -> reference
+    {
+      return m_data.back();
+    }
+
+    auto constexpr back() const -> const_reference
+    {
+      return m_data.back();
+    }
+
+    auto constexpr data() noexcept -> pointer
+    {
+      return m_data.data();
+    }
+
+    auto constexpr data() const noexcept -> const_pointer
+    {
+      return m_data.data();
+    }
+
+    auto constexpr begin() noexcept -> iterator
+    {
+      return m_data.begin();
+    }
+
+    auto constexpr begin() const noexcept -> const_iterator
+    {
+      return m_data.begin();
+    }
+
+    auto constexpr cbegin() const noexcept -> const_iterator
+    {
+      return m_data.cbegin();
+    }
+
+    auto constexpr rbegin() noexcept -> reverse_iterator
+    {
+      return m_data.rbegin();
+    }
+
+    auto constexpr rbegin() const noexcept -> const_reverse_iterator
+    {
+      return m_data.rbegin();
+    }
+
+    auto constexpr crbegin() const noexcept -> const_reverse_iterator
+    {
+      return m_data.crbegin();
+    }
+
+    auto constexpr end() noexcept -> iterator
+    {
+      return m_data.end();
+    }
+
+    auto constexpr end() const noexcept -> const_iterator
+    {
+      return m_data.end();
+    }
+
+    auto constexpr cend() const noexcept -> const_iterator
+    {
+      return m_data.cend();
+    }
+
+    auto constexpr rend() noexcept -> reverse_iterator
+    {
+      return m_data.rend();
+    }
+
+    auto constexpr rend() const noexcept -> const_reverse_iterator
+    {
+      return m_data.rend();
+    }
+
+    auto constexpr crend() const noexcept -> const_reverse_iterator
+    {
+      return m_data.crend();
+    }
+
+    auto constexpr indices() const noexcept -> std::ranges::iota_view<index_type, index_type>
+    {
+      using index_base_type = typename index_type::base_type;
+      return nt::indices(index_type{index_base_type{}}, index_type{static_cast<index_base_type>(m_data.size())});
+    }
+
+    auto constexpr empty() const noexcept -> bool
+    {
+      return m_data.empty();
+    }
+
+    auto constexpr size() const noexcept -> size_type
+    {
+      return m_data.size();
+    }
+
+    auto constexpr capacity() const noexcept -> size_type
+    {
+      return m_data.capacity();
+    }
+
+    auto constexpr reserve(size_type capacity) -> void
+    {
+      m_data.reserve(capacity);
+    }
+
+    auto constexpr resize(size_type count) -> void
+    {
+      m_data.resize(count);
+    }
+
+    auto constexpr resize(size_type count, value_type const & value) -> void
+    {
+      m_data.resize(count, value);
+    }
+
+    auto constexpr clear() noexcept -> void
+    {
+      m_data.clear();
+    }
+
+    auto constexpr push_back(value_type const & value) -> void
+    {
+      m_data.push_back(value);
+    }
+
+    auto constexpr push_back(value_type && value) -> void
+    {
+      m_data.push_back(std::move(value));
+    }
+
+    template<typename... ArgumentTypes>
+    auto constexpr emplace_back(ArgumentTypes &&... arguments) -> reference
+    {
+      return m_data.emplace_back(std::forward<ArgumentTypes>(arguments)...);
+    }
+
+    auto constexpr pop_back() -> void
+    {
+      m_data.pop_back();
+    }
+
+    auto constexpr get_allocator() const noexcept -> allocator_type
+    {
+      return m_data.get_allocator();
+    }
+
+    auto constexpr operator==(indexed_vector const &) const -> bool = default;
+
+  private:
+    container_type m_data;
+  };
+
+}  // namespace nt
+
+#endif
@@ -0,0 +1,131 @@
+#ifndef NEWTYPE_INSTRUMENTED_HPP
+#define NEWTYPE_INSTRUMENTED_HPP
+
+#include "newtype/core.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace nt
+{
+
+  namespace impl
+  {
+
+    inline namespace counting
+    {
+
+      template<typename TagType>
+      struct operation_counters
+      {
+        auto static increment(operation performed) noexcept -> void
+        {
+          values[static_cast<std::size_t>(performed)].fetch_add(1, std::memory_order_relaxed);
+        }
+
+        inline static std::array<std::atomic<std::uint64_t>, static_cast<std::size_t>(operation::count)> values{};
+      };
+
+      template<typename TagType, auto DerivationClause>
+      struct operation_probe
+      {
+        constexpr operation_probe() noexcept
+        {
+          record<TagType, DerivationClause>(operation::construction);
+        }
+
+        constexpr operation_probe(operation_probe const &) noexcept
+        {
+          record<TagType, DerivationClause>(operation::copy);
+        }
+
+        constexpr operation_probe(operation_probe &&) noexcept
+        {
+          record<TagType, DerivationClause>(operation::move);
+        }
+
+        auto constexpr operator=(operation_probe const &) noexcept -> operation_probe &
+        {
+          record<TagType, DerivationClause>(operation::copy_assignment);
+          return *this;
+        }
+
+        auto constexpr operator=(operation_probe &&) noexcept -> operation_probe &
+        {
+          record<TagType, DerivationClause>(operation::move_assignment);
+          return *this;
+        }
+      };
+
+    }  // namespace counting
+
+    inline namespace storage
+    {
+
+      template<typename BaseType, typename TagType, auto DerivationClause>
+      struct new_type_instrumentation<BaseType, TagType, DerivationClause, true> : new_type_hash_cache<BaseType, TagType, DerivationClause>
+      {
+        using new_type_hash_cache<BaseType, TagType, DerivationClause>::new_type_hash_cache;
+
+        constexpr new_type_instrumentation() = default;
+
+        [[no_unique_address]] operation_probe<TagType, DerivationClause> m_probe{};
+      };
+
+    }  // namespace storage
+
+  }  // namespace impl
+
+  namespace instrumentation
+  {
+
+    struct counters
+    {
+      std::uint64_t constructions;
+      std::uint64_t copies;
+      std::uint64_t moves;
+      std::uint64_t copy_assignments;
+      std::uint64_t move_assignments;
+      std::uint64_t arithmetic;
+      std::uint64_t comparisons;
+      std::uint64_t hashes;
+
+      auto constexpr operator==(counters const &) const noexcept -> bool = default;
+    };
+
+    template<typename TagType>
+    auto snapshot() noexcept -> counters
+    {
+      auto const & source = impl::operation_counters<TagType>::values;
+      auto load = [&](impl::operation counted) {
+        return source[static_cast<std::size_t>(counted)].load(std::memory_order_relaxed);
+      };
+
+      return {
+          .constructions = load(impl::operation::construction),
+          .copies = load(impl::operation::copy),
+          .moves = load(impl::operation::move),
+          .copy_assignments = load(impl::operation::copy_assignment),
+          .move_assignments = load(impl::operation::move_assignment),
+          .arithmetic = load(impl::operation::arithmetic),
+          .comparisons = load(impl::operation::comparison),
+          .hashes = load(impl::operation::hash),
+      };
+    }
+
+    template<typename TagType>
+    auto reset() noexcept -> void
+    {
+      for (auto & counter : impl::operation_counters<TagType>::values)
+      {
+        counter.store(0, std::memory_order_relaxed);
+      }
+    }
+
+  }  // namespace instrumentation
+
+}  // namespace nt
+
+#endif
@@ -0,0 +1,197 @@
+#ifndef NEWTYPE_INTERNED_HPP
+#define NEWTYPE_INTERNED_HPP
+
+#include <array>
+#include <compare>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+
+namespace nt
+{
+
+  namespace impl
+  {
+
+    struct interned_entry
+    {
+      std::size_t hash;
+      std::string value;
+    };
+
+    struct interned_key
+    {
+      std::size_t hash;
+      std::string_view value;
+
+      auto constexpr operator==(interned_key const & other) const noexcept -> bool
+      {
+        return hash == other.hash && value == other.value;
+      }
+    };
+
+    struct interned_key_hash
+    {
+      auto constexpr operator()(interned_key const & key) const noexcept -> std::size_t
+      {
+        return key.hash;
+      }
+    };
+
+    struct null_mutex
+    {
+      auto constexpr lock() noexcept -> void
+      {
+      }
+
+      auto constexpr unlock() noexcept -> void
+      {
+      }
+    };
+
+    template<bool ThreadSafe>
+    class intern_table
+    {
+      using mutex_type = std::conditional_t<ThreadSafe, std::mutex, null_mutex>;
+
+      struct stripe
+      {
+        mutable mutex_type mutex;
+        std::unordered_map<interned_key, std::unique_ptr<interned_entry const>, interned_key_hash> entries;
+      };
+
+    public:
+      auto intern(std::string_view value) -> interned_entry const *
+      {
+        auto hash = std::hash<std::string_view>{}(value);
+        auto & stripe = m_stripes[hash % m_stripes.size()];
+        auto lock = std::scoped_lock{stripe.mutex};
+
+        if (auto found = stripe.entries.find(interned_key{hash, value}); found != stripe.entries.end())
+        {
+          return found->second.get();
+        }
+
+        auto entry = std::unique_ptr<interned_entry const>{new interned_entry const{hash, std::string{value}}};
+        auto key = interned_key{hash, entry->value};
+        return stripe.entries.emplace(key, std::move(entry)).first->second.get();
+      }
+
+      auto size() const -> std::size_t
+      {
+        auto size = std::size_t{};
+        for (auto const & stripe : m_stripes)
+        {
+          auto lock = std::scoped_lock{stripe.mutex};
+          size += stripe.entries.size();
+        }
+        return size;
+      }
+
+    private:
+      std::array<stripe, ThreadSafe ? 16 : 1> m_stripes{};
+    };
+
+  }  // namespace impl
+
+  template<typename TagType, bool ThreadSafe = true>
+  class interned
+  {
+  public:
+    using tag_type = TagType;
+
+    constexpr interned() noexcept = default;
+
+    explicit interned(std::string_view value)
+        : m_entry{value.empty() ? nullptr : table().intern(value)}
+    {
+    }
+
+    auto constexpr view() const noexcept -> std::string_view
+    {
+      return m_entry ? std::string_view{m_entry->value} : std::string_view{};
+    }
+
+    auto constexpr data() const noexcept -> char const *
+    {
+      return m_entry ? m_entry->value.c_str() : "";
+    }
+
+    auto constexpr size() const noexcept -> std::size_t
+    {
+      return m_entry ? m_entry->value.size() : 0;
+    }
+
+    auto constexpr empty() const noexcept -> bool
+    {
+      return m_entry == nullptr;
+    }
+
+    auto constexpr hash() const noexcept -> std::size_t
+    {
+      return m_entry ? m_entry->hash : 0;
+    }
+
+    explicit constexpr operator std::string_view() const noexcept
+    {
+      return view();
+    }
+
+    auto constexpr operator==(interned const & other) const noexcept -> bool
+    {
+      return m_entry == other.m_entry;
+    }
+
+    auto constexpr operator<=>(interned const & other) const noexcept -> std::strong_ordering
+    {
+      if (m_entry == other.m_entry)
+      {
+        return std::strong_ordering::equal;
+      }
+      return view() <=> other.view();
+    }
+
+    static auto pool_size() -> std::size_t
+    {
+      return table().size();
+    }
+
+  private:
+    static auto table() -> impl::intern_table<ThreadSafe> &
+    {
+      static auto instance = impl::intern_table<ThreadSafe>{};
+      return instance;
+    }
+
+    impl::interned_entry const * m_entry{};
+  };
+
+  template<typename TagType, bool ThreadSafe>
+  auto operator<<(std::ostream & output, interned<TagType, ThreadSafe> const & value) -> std::ostream &
+  {
+    return output << value.view();
+  }
+
+}  // namespace nt
+
+namespace std
+{
+
+  template<typename TagType, bool ThreadSafe>
+  struct hash<nt::interned<TagType, ThreadSafe>>
+  {
+    auto constexpr operator()(nt::interned<TagType, ThreadSafe> const & value) const noexcept -> std::size_t
+    {
+      return value.hash();
+    }
+  };
+
+}  // namespace std
+
+#endif
@@ -0,0 +1,178 @@
+#ifndef NEWTYPE_ITERABLE_HPP
+#define NEWTYPE_ITERABLE_HPP
+
+#include "newtype/core.hpp"
+
+#include <iterator>
+#include <ranges>
+#include <type_traits>
+
+namespace nt
+{
+
+  namespace impl
+  {
+
+    inline namespace member_types
+    {
+
+      template<typename T, bool = false, typename = std::void_t<>>
+      struct new_type_iterator
+      {
+      };
+
+      template<typename T>
+      struct new_type_iterator<T, true, std::void_t<typename T::iterator>>
+      {
+        using iterator = typename T::iterator;
+      };
+
+      template<typename T, bool = false, typename = std::void_t<>>
+      struct new_type_const_iterator
+      {
+      };
+
+      template<typename T>
+      struct new_type_const_iterator<T, true, std::void_t<typename T::const_iterator>>
+      {
+        using const_iterator = typename T::const_iterator;
+      };
+
+      template<typename T, bool = false, typename = std::void_t<>>
+      struct new_type_reverse_iterator
+      {
+      };
+
+      template<typename T>
+      struct new_type_reverse_iterator<T, true, std::void_t<typename T::reverse_iterator>>
+      {
+        using reverse_iterator = typename T::reverse_iterator;
+      };
+
+      template<typename T, bool = false, typename = std::void_t<>>
+      struct new_type_const_reverse_iterator
+      {
+      };
+
+      template<typename T>
+      struct new_type_const_reverse_iterator<T, true, std::void_t<typename T::const_reverse_iterator>>
+      {
+        using const_reverse_iterator = typename T::const_reverse_iterator;
+      };
+
+      template<typename T>
+      struct new_type_iterator_types<T, true>
+          : new_type_iterator<T, true>
+          , new_type_const_iterator<T, true>
+          , new_type_reverse_iterator<T, true>
+          , new_type_const_reverse_iterator<T, true>
+      {
+      };
+
+    }  // namespace member_types
+
+  }  // namespace impl
+
+  template<nt::concepts::free_begin BaseType, typename TagType, nt::derives<nt::Iterable> auto DerivationClause>
+    requires(!nt::derives<decltype(DerivationClause), nt::CachedHash>)
+  auto constexpr begin(new_type<BaseType, TagType, DerivationClause> & obj) -> typename new_type<BaseType, TagType, DerivationClause>::iterator
+  {
+    return begin(impl::new_type_access::value(obj));
+  }
+
+  template<nt::concepts::const_free_begin BaseType, typename TagType, nt::derives<nt::Iterable> auto DerivationClause>
+  auto constexpr begin(new_type<BaseType, TagType, DerivationClause> const & obj) ->
+      typename new_type<BaseType, TagType, DerivationClause>::const_iterator
+  {
+    return begin(impl::new_type_access::value(obj));
+  }
+
+  template<nt::concepts::free_cbegin BaseType, typename TagType, nt::derives<nt::Iterable> auto DerivationClause>
+  auto constexpr cbegin(new_type<BaseType, TagType, DerivationClause> const & obj) ->
+      typename new_type<BaseType, TagType, DerivationClause>::const_iterator
+  {
+    return cbegin(impl::new_type_access::value(obj));
+  }
+
+  template<nt::concepts::free_rbegin BaseType, typename TagType, nt::derives<nt::Iterable> auto DerivationClause>
+    requires(!nt::derives<decltype(DerivationClause), nt::CachedHash>)
+  auto constexpr rbegin(new_type<BaseType, TagType, DerivationClause> & obj) ->
+      typename new_type<BaseType, TagType, DerivationClause>::reverse_iterator
+  {
+    return rbegin(impl::new_type_access::value(obj));
+  }
+
+  template<nt::concepts::const_free_rbegin BaseType, typename TagType, nt::derives<nt::Iterable> auto DerivationClause>
+  auto constexpr rbegin(new_type<BaseType, TagType, DerivationClause> const & obj) ->
+      typename new_type<BaseType, TagType, DerivationClause>::const_reverse_iterator
+  {
+    return rbegin(impl::new_type_access::value(obj));
+  }
+
+  template<nt::concepts::free_crbegin BaseType, typename TagType, nt::derives<nt::Iterable> auto DerivationClause>
+  auto constexpr crbegin(new_type<BaseType, TagType, DerivationClause> const & obj) ->
+      typename new_type<BaseType, TagType, DerivationClause>::const_reverse_iterator
+  {
+    return crbegin(impl::new_type_access::value(obj));
+  }
+
+  template<nt::concepts::free_end BaseType, typename TagType, nt::derives<nt::Iterable> auto DerivationClause>
+    requires(!nt::derives<decltype(DerivationClause), nt::CachedHash>)
+  auto constexpr end(new_type<BaseType, TagType, DerivationClause> & obj) -> typename new_type<BaseType, TagType, DerivationClause>::iterator
+  {
+    return end(impl::new_type_access::value(obj));
+  }
+
+  template<nt::concepts::const_free_end BaseType, typename TagType, nt::derives<nt::Iterable> auto DerivationClause>
+  auto constexpr end(new_type<BaseType, TagType, DerivationClause> const & obj) ->
+      typename new_type<BaseType, TagType, DerivationClause>::const_iterator
+  {
+    return end(impl::new_type_access::value(obj));
+  }
+
+  template<nt::concepts::free_cend BaseType, typename TagType, nt::derives<nt::Iterable> auto DerivationClause>
+  auto constexpr cend(new_type<BaseType, TagType, DerivationClause> const & obj) ->
+      typename new_type<BaseType, TagType, DerivationClause>::const_iterator
+  {
+    return cend(impl::new_type_access::value(obj));
+  }
+
+  template<nt::concepts::free_rend BaseType, typename TagType, nt::derives<nt::Iterable> auto DerivationClause>
+    requires(!nt::derives<decltype(DerivationClause), nt::CachedHash>)
+  auto constexpr rend(new_type<BaseType, TagType, DerivationClause> & obj) ->
+      typename new_type<BaseType, TagType, DerivationClause>::reverse_iterator
+  {
+    return rend(impl::new_type_access::value(obj));
+  }
+
+  template<nt::concepts::const_free_rend BaseType, typename TagType, nt::derives<nt::Iterable> auto DerivationClause>
+  auto constexpr rend(new_type<BaseType, TagType, DerivationClause> const & obj) ->
+      typename new_type<BaseType, TagType, DerivationClause>::const_reverse_iterator
+  {
+    return rend(impl::new_type_access::value(obj));
+  }
+
+  template<nt::concepts::free_crend BaseType, typename TagType, nt::derives<nt::Iterable> auto DerivationClause>
+  auto constexpr crend(new_type<BaseType, TagType, DerivationClause> const & obj) ->
+      typename new_type<BaseType, TagType, DerivationClause>::const_reverse_iterator
+  {
+    return crend(impl::new_type_access::value(obj));
+  }
+
+}  // namespace nt
+
+namespace std
+{
+  namespace ranges
+  {
+    template<typename BaseType, typename TagType, auto DerivationClause>
+    inline constexpr bool enable_borrowed_range<nt::new_type<BaseType, TagType, DerivationClause>> =
+        nt::derives<decltype(DerivationClause), nt::Iterable> && enable_borrowed_range<BaseType>;
+
+    template<typename BaseType, typename TagType, auto DerivationClause>
+    inline constexpr bool enable_view<nt::new_type<BaseType, TagType, DerivationClause>> =
+        nt::derives<decltype(DerivationClause), nt::Iterable> && enable_view<BaseType>;
+  }  // namespace ranges
+}  // namespace std
+
+#endif
@@ -0,0 +1,320 @@
+#ifndef NEWTYPE_OPTIONAL_HPP
+#define NEWTYPE_OPTIONAL_HPP
+
+#include "newtype/core.hpp"
+#include "newtype/hash.hpp"
+
+#include <cassert>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace nt
+{
+
+  namespace impl
+  {
+
+    template<typename... DerivableTags>
+    struct sentinel_search
+    {
+    };
+
+    template<auto Value, typename... DerivableTags>
+    struct sentinel_search<sentinel_tag<Value>, DerivableTags...>
+    {
+      auto constexpr static value = Value;
+    };
+
+    template<typename DerivableTag, typename... DerivableTags>
+    struct sentinel_search<DerivableTag, DerivableTags...> : sentinel_search<DerivableTags...>
+    {
+    };
+
+    template<typename DerivationClause>
+    struct clause_sentinel
+    {
+    };
+
+    template<typename... DerivableTags>
+    struct clause_sentinel<derivation_clause<DerivableTags...>> : sentinel_search<DerivableTags...>
+    {
+    };
+
+    template<typename... DerivableTags>
+    struct clause_sentinel<derivation_clause<DerivableTags...> const> : sentinel_search<DerivableTags...>
+    {
+    };
+
+  }  // namespace impl
+
+  namespace concepts
+  {
+
+    inline namespace niche
+    {
+
+      template<typename SubjectType>
+      concept sentinel_reserving = requires {
+        typename SubjectType::base_type;
+        typename SubjectType::derivation_clause_type;
+        impl::clause_sentinel<typename SubjectType::derivation_clause_type>::value;
+        requires std::constructible_from<typename SubjectType::base_type,
+                                         decltype(impl::clause_sentinel<typename SubjectType::derivation_clause_type>::value)>;
+        requires std::constructible_from<SubjectType, typename SubjectType::base_type>;
+        requires std::equality_comparable<typename SubjectType::base_type>;
+        requires std::copy_constructible<SubjectType>;
+      };
+
+    }  // namespace niche
+
+  }  // namespace concepts
+
+  template<nt::concepts::sentinel_reserving NewType>
+  class optional
+  {
+  public:
+    using value_type = NewType;
+    using base_type = typename NewType::base_type;
+
+    auto constexpr static sentinel = base_type{impl::clause_sentinel<typename NewType::derivation_clause_type>::value};
+
+    constexpr optional() noexcept(std::is_nothrow_constructible_v<value_type, base_type>)
+        : m_value{sentinel}
+    {
+    }
+
+    constexpr optional(std::nullopt_t) noexcept(std::is_nothrow_constructible_v<value_type, base_type>)
+        : optional{}
+    {
+    }
+
+    constexpr optional(value_type const & value) noexcept(std::is_nothrow_copy_constructible_v<value_type>)
+        : m_value{value}
+    {
+      assert(has_value() && "nt::optional: the value must not be equal to the sentinel");
+    }
+
+    template<typename... ArgumentTypes>
+      requires std::constructible_from<value_type, ArgumentTypes...>
+    constexpr explicit optional(std::in_place_t, ArgumentTypes &&... arguments) noexcept(
+        std::is_nothrow_constructible_v<value_type, ArgumentTypes...>)
+        : m_value{std::forward<ArgumentTypes>(arguments)...}
+    {
+      assert(has_value() && "nt::optional: the value must not be equal to the sentinel");
+    }
+
+    auto constexpr operator=(std::nullopt_t) noexcept(std::is_nothrow_constructible_v<value_type, base_type> &&
+                                                      std::is_nothrow_move_assignable_v<value_type>) -> optional &
+    {
+      reset();
+      return *this;
+    }
+
+    auto constexpr operator=(value_type const & value) noexcept(std::is_nothrow_copy_assignable_v<value_type>) -> optional &
+    {
+      m_value = value;
+      assert(has_value() && "nt::optional: the value must not be equal to the sentinel");
+      return *this;
+    }
+
+    template<typename... ArgumentTypes>
+      requires std::constructible_from<value_type, ArgumentTypes...>
+    auto constexpr emplace(ArgumentTypes &&... arguments) -> value_type &
+    {
+      if constexpr (std::is_nothrow_constructible_v<value_type, ArgumentTypes...>)
+      {
+        std::destroy_at(std::addressof(m_value));
+        std::construct_at(std::addressof(m_value), std::forward<ArgumentTypes>(arguments)...);
+      }
+      else
+      {
+        m_value = value_type{std::forward<ArgumentTypes>(arguments)...};
+      }
+      assert(has_value() && "nt::optional: the value must not be equal to the sentinel");
+      return m_value;
+    }
+
+    auto constexpr reset() noexcept(std::is_nothrow_constructible_v<value_type, base_type> && std::is_nothrow_move_assignable_v<value_type>)
+        -> void
+    {
+      m_value = value_type{sentinel};
+    }
+
+    auto constexpr swap(optional & other) noexcept(std::is_nothrow_swappable_v<value_type>) -> void
+    {
+      using std::swap;
+      swap(m_value, other.m_value);
+    }
+
+    auto constexpr has_value() const noexcept -> bool
+    {
+      auto const & value = impl::new_type_access::value(m_value);
+      if constexpr (std::is_floating_point_v<base_type>)
+      {
+        if (sentinel != sentinel)
+        {
+          return value == value;
+        }
+      }
+      return !(value == sentinel);
+    }
+
+    explicit constexpr operator bool() const noexcept
+    {
+      return has_value();
+    }
+
+    auto constexpr operator*() & noexcept -> value_type &
+    {
+      return m_value;
+    }
+
+    auto constexpr operator*() const & noexcept -> value_type const &
+    {
+      return m_value;
+    }
+
+    auto constexpr operator*() && noexcept -> value_type &&
+    {
+      return std::move(m_value);
+    }
+
+    auto constexpr operator->() noexcept -> value_type *
+    {
+      return std::addressof(m_value);
+    }
+
+    auto constexpr operator->() const noexcept -> value_type const *
+    {
+      return std::addressof(m_value);
+    }
+
+    auto constexpr value() & -> value_type &
+    {
+      if (!has_value())
+      {
+        throw std::bad_optional_access{};
+      }
+      return m_value;
+    }
+
+    auto constexpr value() const & -> value_type const &
+    {
+      if (!has_value())
+      {
+        throw std::bad_optional_access{};
+      }
+      return m_value;
+    }
+
+    auto constexpr value() && -> value_type &&
+    {
+      if (!has_value())
+      {
+        throw std::bad_optional_access{};
+      }
+      return std::move(m_value);
+    }
+
+    template<std::convertible_to<value_type> FallbackType>
+    auto constexpr value_or(FallbackType && fallback) const & -> value_type
+    {
+      return has_value() ? m_value : static_cast<value_type>(std::forward<FallbackType>(fallback));
+    }
+
+    template<std::convertible_to<value_type> FallbackType>
+    auto constexpr value_or(FallbackType && fallback) && -> value_type
+    {
+      return has_value() ? std::move(m_value) : static_cast<value_type>(std::forward<FallbackType>(fallback));
+    }
+
+  private:
+    value_type m_value;
+  };
+
+  template<typename NewType>
+  auto constexpr swap(optional<NewType> & lhs, optional<NewType> & rhs) noexcept(noexcept(lhs.swap(rhs))) -> void
+  {
+    lhs.swap(rhs);
+  }
+
+  template<typename NewType>
+    requires std::equality_comparable<NewType>
+  auto constexpr operator==(optional<NewType> const & lhs, optional<NewType> const & rhs) -> bool
+  {
+    if (lhs.has_value() != rhs.has_value())
+    {
+      return false;
+    }
+    return !lhs.has_value() || *lhs == *rhs;
+  }
+
+  template<typename NewType>
+  auto constexpr operator==(optional<NewType> const & lhs, std::nullopt_t) noexcept -> bool
+  {
+    return !lhs.has_value();
+  }
+
+  template<typename NewType>
+    requires std::equality_comparable<NewType>
+  auto constexpr operator==(optional<NewType> const & lhs, NewType const & rhs) -> bool
+  {
+    return lhs.has_value() && *lhs == rhs;
+  }
+
+  template<typename NewType>
+    requires(nt::derives<typename NewType::derivation_clause_type, nt::Relational> &&
+             std::three_way_comparable<typename NewType::base_type>)
+  auto constexpr operator<=>(optional<NewType> const & lhs, optional<NewType> const & rhs)
+      -> std::compare_three_way_result_t<typename NewType::base_type>
+  {
+    if (lhs.has_value() && rhs.has_value())
+    {
+      return impl::new_type_access::value(*lhs) <=> impl::new_type_access::value(*rhs);
+    }
+    return lhs.has_value() <=> rhs.has_value();
+  }
+
+  template<typename NewType>
+  auto constexpr operator<=>(optional<NewType> const & lhs, std::nullopt_t) noexcept -> std::strong_ordering
+  {
+    return lhs.has_value() <=> false;
+  }
+
+  template<typename NewType>
+    requires(nt::derives<typename NewType::derivation_clause_type, nt::Relational> &&
+             std::three_way_comparable<typename NewType::base_type>)
+  auto constexpr operator<=>(optional<NewType> const & lhs, NewType const & rhs)
+      -> std::compare_three_way_result_t<typename NewType::base_type>
+  {
+    if (lhs.has_value())
+    {
+      return impl::new_type_access::value(*lhs) <=> impl::new_type_access::value(rhs);
+    }
+    return std::strong_ordering::less;
+  }
+
+}  // namespace nt
+
+namespace std
+{
+
+  template<typename NewType>
+    requires std::is_default_constructible_v<std::hash<NewType>>
+  struct hash<nt::optional<NewType>>
+  {
+    auto constexpr operator()(nt::optional<NewType> const & value) const -> std::size_t
+    {
+      return value.has_value() ? std::hash<NewType>{}(*value) : std::size_t{};
+    }
+  };
+
+}  // namespace std
+
+#endif
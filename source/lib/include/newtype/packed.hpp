@@ -0,0 +1,213 @@
+#ifndef NEWTYPE_PACKED_HPP
+#define NEWTYPE_PACKED_HPP
+
+#include "newtype/core.hpp"
+#include "newtype/hash.hpp"
+
+#include <array>
+#include <bit>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <type_traits>
+
+namespace nt
+{
+
+  namespace impl
+  {
+
+    template<std::size_t Size>
+    struct packed_representation;
+
+    template<>
+    struct packed_representation<1>
+    {
+      using type = std::uint8_t;
+    };
+
+    template<>
+    struct packed_representation<2>
+    {
+      using type = std::uint16_t;
+    };
+
+    template<>
+    struct packed_representation<4>
+    {
+      using type = std::uint32_t;
+    };
+
+    template<>
+    struct packed_representation<8>
+    {
+      using type = std::uint64_t;
+    };
+
+  }  // namespace impl
+
+  namespace concepts
+  {
+
+    inline namespace packing
+    {
+
+      template<typename SubjectType>
+      concept fully_representable =
+          (std::integral<SubjectType> && !std::same_as<std::remove_cv_t<SubjectType>, bool>) ||
+          (std::floating_point<SubjectType> && std::numeric_limits<SubjectType>::is_iec559) ||
+          (std::is_enum_v<SubjectType> && requires { SubjectType{std::underlying_type_t<SubjectType>{}}; });
+
+      template<typename SubjectType>
+      concept packable = requires {
+        typename SubjectType::base_type;
+        typename impl::packed_representation<sizeof(typename SubjectType::base_type)>::type;
+        requires fully_representable<typename SubjectType::base_type>;
+        requires std::constructible_from<SubjectType, typename SubjectType::base_type>;
+      };
+
+    }  // namespace packing
+
+  }  // namespace concepts
+
+  template<nt::concepts::packable NewType, std::endian Endianness>
+    requires(Endianness == std::endian::big || Endianness == std::endian::little)
+  class packed
+  {
+    using representation_type = typename impl::packed_representation<sizeof(typename NewType::base_type)>::type;
+
+  public:
+    using value_type = NewType;
+    using base_type = typename NewType::base_type;
+
+    auto constexpr static endianness = Endianness;
+
+    constexpr packed() noexcept = default;
+
+    constexpr packed(value_type const & value) noexcept
+    {
+      store(value);
+    }
+
+    auto constexpr operator=(value_type const & value) noexcept -> packed &
+    {
+      store(value);
+      return *this;
+    }
+
+    auto constexpr load() const noexcept -> value_type
+    {
+      auto representation = representation_type{};
+      for (auto index = std::size_t{}; index < sizeof(representation_type); ++index)
+      {
+        auto shift = 8 * (Endianness == std::endian::big ? sizeof(representation_type) - 1 - index : index);
+        representation |= static_cast<representation_type>(static_cast<representation_type>(m_bytes[index]) << shift);
+      }
+
+      if constexpr (std::is_enum_v<base_type>)
+      {
+        return value_type{static_cast<base_type>(representation)};
+      }
+      else
+      {
+        return value_type{std::bit_cast<base_type>(representation)};
+      }
+    }
+
+    constexpr operator value_type() const noexcept
+    {
+      return load();
+    }
+
+    auto constexpr store(value_type const & value) noexcept -> void
+    {
+      auto representation = representation_type{};
+      if constexpr (std::is_enum_v<base_type>)
+      {
+        representation = static_cast<representation_type>(value.decay());
+      }
+      else
+      {
+        representation = std::bit_cast<representation_type>(value.decay());
+      }
+
+      for (auto index = std::size_t{}; index < sizeof(representation_type); ++index)
+      {
+        auto shift = 8 * (Endianness == std::endian::big ? sizeof(representation_type) - 1 - index : index);
+        m_bytes[index] = static_cast<std::byte>(representation >> shift);
+      }
+    }
+
+    auto constexpr bytes() const noexcept -> std::array<std::byte, sizeof(representation_type)> const &
+    {
+      return m_bytes;
+    }
+
+  private:
+    std::array<std::byte, sizeof(representation_type)> m_bytes;
+  };
+
+  template<typename NewType>
+  using packed_be = packed<NewType, std::endian::big>;
+
+  template<typename NewType>
+  using packed_le = packed<NewType, std::endian::little>;
+
+  template<typename NewType, std::endian Endianness>
+    requires std::equality_comparable<NewType>
+  auto constexpr operator==(packed<NewType, Endianness> const & lhs, packed<NewType, Endianness> const & rhs) noexcept -> bool
+  {
+    if constexpr (std::is_floating_point_v<typename NewType::base_type>)
+    {
+      return lhs.load() == rhs.load();
+    }
+    else
+    {
+      return lhs.bytes() == rhs.bytes();
+    }
+  }
+
+  template<typename NewType, std::endian Endianness>
+    requires std::equality_comparable<NewType>
+  auto constexpr operator==(packed<NewType, Endianness> const & lhs, NewType const & rhs) noexcept -> bool
+  {
+    return lhs.load() == rhs;
+  }
+
+  template<typename NewType, std::endian Endianness>
+    requires(nt::derives<typename NewType::derivation_clause_type, nt::Relational> &&
+             std::three_way_comparable<typename NewType::base_type>)
+  auto constexpr operator<=>(packed<NewType, Endianness> const & lhs, packed<NewType, Endianness> const & rhs) noexcept
+  {
+    return lhs.load().decay() <=> rhs.load().decay();
+  }
+
+  template<typename NewType, std::endian Endianness>
+    requires(nt::derives<typename NewType::derivation_clause_type, nt::Relational> &&
+             std::three_way_comparable<typename NewType::base_type>)
+  auto constexpr operator<=>(packed<NewType, Endianness> const & lhs, NewType const & rhs) noexcept
+  {
+    return lhs.load().decay() <=> rhs.decay();
+  }
+
+}  // namespace nt
+
+namespace std
+{
+
+  template<typename NewType, std::endian Endianness>
+    requires std::is_default_constructible_v<std::hash<NewType>>
+  struct hash<nt::packed<NewType, Endianness>>
+  {
+    auto constexpr operator()(nt::packed<NewType, Endianness> const & value) const -> std::size_t
+    {
+      return std::hash<NewType>{}(value.load());
+    }
+  };
+
+}  // namespace std
+
+#endif
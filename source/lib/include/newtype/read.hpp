@@ -0,0 +1,26 @@
+#ifndef NEWTYPE_READ_HPP
+#define NEWTYPE_READ_HPP
+
+#include "newtype/core.hpp"
+
+#include <istream>
+
+namespace nt
+{
+
+  template<typename CharType,
+           typename StreamTraits,
+           nt::concepts::input_streamable<CharType, StreamTraits> BaseType,
+           typename TagType,
+           nt::derives<nt::Read> auto DerivationClause>
+  auto operator>>(std::basic_istream<CharType, StreamTraits> & input, new_type<BaseType, TagType, DerivationClause> & target) noexcept(
+      nt::concepts::nothrow_input_streamable<BaseType, CharType, StreamTraits>) -> std::basic_istream<CharType, StreamTraits> &
+  {
+    input >> impl::new_type_access::value(target);
+    impl::new_type_access::rehash(target);
+    return input;
+  }
+
+}  // namespace nt
+
+#endif
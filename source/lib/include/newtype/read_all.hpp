@@ -0,0 +1,189 @@
+#ifndef NEWTYPE_READ_ALL_HPP
+#define NEWTYPE_READ_ALL_HPP
+
+#include "newtype/core.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#if __has_include(<unistd.h>)
+#include <cerrno>
+
+#include <unistd.h>
+#endif
+
+namespace nt
+{
+
+  namespace concepts
+  {
+
+    inline namespace bulk_input
+    {
+
+      template<typename SubjectType>
+      concept from_chars_parsable = requires(char const * first, char const * last, SubjectType & value) {
+        { std::from_chars(first, last, value) } -> std::same_as<std::from_chars_result>;
+      };
+
+      template<typename SubjectType>
+      concept bulk_readable = requires {
+        typename SubjectType::base_type;
+        typename SubjectType::derivation_clause_type;
+        requires nt::derives<typename SubjectType::derivation_clause_type, nt::Read>;
+        requires from_chars_parsable<typename SubjectType::base_type>;
+        requires std::constructible_from<SubjectType, typename SubjectType::base_type>;
+      };
+
+    }  // namespace bulk_input
+
+  }  // namespace concepts
+
+  template<typename OutputIterator>
+  struct read_all_result
+  {
+    OutputIterator out;
+    std::size_t offset;
+    std::errc error;
+  };
+
+  class read_error : public std::system_error
+  {
+  public:
+    read_error(std::errc error, std::size_t offset)
+        : std::system_error{std::make_error_code(error), "nt::read_all: failed to read value at offset " + std::to_string(offset)}
+        , m_offset{offset}
+    {
+    }
+
+    auto offset() const noexcept -> std::size_t
+    {
+      return m_offset;
+    }
+
+  private:
+    std::size_t m_offset;
+  };
+
+  template<nt::concepts::bulk_readable NewType, std::output_iterator<NewType> OutputIterator>
+  auto read_all(std::string_view input, OutputIterator output, char separator = '\n') -> read_all_result<OutputIterator>
+  {
+    auto const first = input.data();
+    auto const last = first + input.size();
+    auto current = first;
+
+    while (current != last)
+    {
+      auto value = typename NewType::base_type{};
+      auto [end, error] = std::from_chars(current, last, value);
+      if (error != std::errc{})
+      {
+        return {std::move(output), static_cast<std::size_t>(current - first), error};
+      }
+      if (separator == '\n' && end != last && *end == '\r')
+      {
+        ++end;
+      }
+      if (end != last && *end != separator)
+      {
+        return {std::move(output), static_cast<std::size_t>(end - first), std::errc::invalid_argument};
+      }
+      *output = NewType{std::move(value)};
+      ++output;
+      current = end == last ? end : end + 1;
+    }
+
+    return {std::move(output), input.size(), std::errc{}};
+  }
+
+  template<nt::concepts::bulk_readable NewType>
+  auto read_all(std::string_view input, char separator = '\n') -> std::vector<NewType>
+  {
+    auto values = std::vector<NewType>{};
+    auto result = read_all<NewType>(input, std::back_inserter(values), separator);
+    if (result.error != std::errc{})
+    {
+      throw read_error{result.error, result.offset};
+    }
+    return values;
+  }
+
+#if __has_include(<unistd.h>)
+  template<nt::concepts::bulk_readable NewType, std::output_iterator<NewType> OutputIterator>
+  auto read_all(int descriptor, OutputIterator output, char separator = '\n', std::size_t chunk_size = 1 << 16)
+      -> read_all_result<OutputIterator>
+  {
+    auto buffer = std::vector<char>(std::max(chunk_size, std::size_t{1}));
+    auto filled = std::size_t{};
+    auto consumed_offset = std::size_t{};
+
+    while (true)
+    {
+      auto count = ::read(descriptor, buffer.data() + filled, buffer.size() - filled);
+      if (count < 0)
+      {
+        if (errno == EINTR)
+        {
+          continue;
+        }
+        return {std::move(output), consumed_offset + filled, static_cast<std::errc>(errno)};
+      }
+
+      filled += static_cast<std::size_t>(count);
+      auto available = std::string_view{buffer.data(), filled};
+
+      if (count == 0)
+      {
+        auto result = read_all<NewType>(available, std::move(output), separator);
+        return {std::move(result.out), consumed_offset + result.offset, result.error};
+      }
+
+      auto boundary = available.rfind(separator);
+      if (boundary == std::string_view::npos)
+      {
+        if (filled == buffer.size())
+        {
+          buffer.resize(buffer.size() * 2);
+        }
+        continue;
+      }
+
+      auto result = read_all<NewType>(available.substr(0, boundary + 1), std::move(output), separator);
+      output = std::move(result.out);
+      if (result.error != std::errc{})
+      {
+        return {std::move(output), consumed_offset + result.offset, result.error};
+      }
+
+      std::copy(buffer.begin() + static_cast<std::ptrdiff_t>(boundary + 1),
+                buffer.begin() + static_cast<std::ptrdiff_t>(filled),
+                buffer.begin());
+      consumed_offset += boundary + 1;
+      filled -= boundary + 1;
+    }
+  }
+
+  template<nt::concepts::bulk_readable NewType>
+  auto read_all(int descriptor, char separator = '\n', std::size_t chunk_size = 1 << 16) -> std::vector<NewType>
+  {
+    auto values = std::vector<NewType>{};
+    auto result = read_all<NewType>(descriptor, std::back_inserter(values), separator, chunk_size);
+    if (result.error != std::errc{})
+    {
+      throw read_error{result.error, result.offset};
+    }
+    return values;
+  }
+#endif
+
+}  // namespace nt
+
+#endif
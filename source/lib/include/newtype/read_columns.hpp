@@ -0,0 +1,306 @@
+#ifndef NEWTYPE_READ_COLUMNS_HPP
+#define NEWTYPE_READ_COLUMNS_HPP
+
+#include "newtype/core.hpp"
+#include "newtype/read_all.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <concepts>
+#include <cstddef>
+#include <cstring>
+#include <stdexcept>
+#include <string_view>
+#include <system_error>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#if __has_include(<unistd.h>)
+#include <cerrno>
+
+#include <unistd.h>
+#endif
+
+namespace nt
+{
+
+  namespace concepts
+  {
+
+    inline namespace bulk_input
+    {
+
+      template<typename SubjectType>
+      concept column_readable = requires {
+        typename SubjectType::base_type;
+        typename SubjectType::derivation_clause_type;
+        requires nt::derives<typename SubjectType::derivation_clause_type, nt::Read>;
+        requires std::default_initializable<typename SubjectType::base_type>;
+        requires std::constructible_from<SubjectType, typename SubjectType::base_type>;
+        requires from_chars_parsable<typename SubjectType::base_type> ||
+                     std::constructible_from<typename SubjectType::base_type, std::string_view>;
+      };
+
+    }  // namespace bulk_input
+
+  }  // namespace concepts
+
+  struct column_format
+  {
+    char delimiter{','};
+    bool header{false};
+  };
+
+  auto constexpr csv = column_format{',', false};
+  auto constexpr tsv = column_format{'\t', false};
+
+  struct read_columns_result
+  {
+    std::size_t offset;
+    std::size_t rows;
+    std::errc error;
+  };
+
+  namespace impl
+  {
+
+    inline auto find(char const * first, char const * last, char character) noexcept -> char const *
+    {
+      if (first == last)
+      {
+        return last;
+      }
+      auto found = static_cast<char const *>(std::memchr(first, character, static_cast<std::size_t>(last - first)));
+      return found ? found : last;
+    }
+
+    template<typename ColumnType>
+    auto parse_field(char const * first, char const * last, typename ColumnType::base_type & value) -> std::from_chars_result
+    {
+      using base_type = typename ColumnType::base_type;
+
+      if constexpr (nt::concepts::from_chars_parsable<base_type>)
+      {
+        auto [end, error] = std::from_chars(first, last, value);
+        if (error != std::errc{})
+        {
+          return {first, error};
+        }
+        if (end != last)
+        {
+          return {end, std::errc::invalid_argument};
+        }
+        return {end, std::errc{}};
+      }
+      else
+      {
+        auto field = std::string_view{first, static_cast<std::size_t>(last - first)};
+        if constexpr (requires { std::integral_constant<std::size_t, base_type::capacity()>{}; })
+        {
+          if (field.size() > base_type::capacity())
+          {
+            return {first, std::errc::value_too_large};
+          }
+        }
+
+        try
+        {
+          value = base_type(field);
+        }
+        catch (std::length_error const &)
+        {
+          return {first, std::errc::value_too_large};
+        }
+        return {last, std::errc{}};
+      }
+    }
+
+    template<typename... ColumnTypes, std::size_t... Indices>
+    auto parse_row(char const * first,
+                   char const * last,
+                   char delimiter,
+                   std::tuple<typename ColumnTypes::base_type...> & values,
+                   std::index_sequence<Indices...>) -> std::from_chars_result
+    {
+      auto result = std::from_chars_result{first, std::errc{}};
+      auto position = first;
+
+      auto parse_column = [&]<std::size_t Index>(std::integral_constant<std::size_t, Index>) {
+        using column_type = std::tuple_element_t<Index, std::tuple<ColumnTypes...>>;
+        auto constexpr is_last = Index + 1 == sizeof...(ColumnTypes);
+
+        auto field_end = find(position, last, delimiter);
+        if (is_last != (field_end == last))
+        {
+          result = {field_end, std::errc::invalid_argument};
+          return false;
+        }
+
+        result = parse_field<column_type>(position, field_end, std::get<Index>(values));
+        position = field_end == last ? last : field_end + 1;
+        return result.ec == std::errc{};
+      };
+
+      (parse_column(std::integral_constant<std::size_t, Indices>{}) && ...);
+      return result;
+    }
+
+    template<typename... ColumnTypes>
+    auto parse_rows(std::string_view input, std::tuple<std::vector<ColumnTypes>...> & columns, char delimiter) -> read_columns_result
+    {
+      auto const first = input.data();
+      auto const last = first + input.size();
+      auto current = first;
+      auto rows = std::size_t{};
+
+      while (current != last)
+      {
+        auto line_end = find(current, last, '\n');
+        auto next = line_end == last ? last : line_end + 1;
+        if (line_end != current && *(line_end - 1) == '\r')
+        {
+          --line_end;
+        }
+
+        auto values = std::tuple<typename ColumnTypes::base_type...>{};
+        auto result = parse_row<ColumnTypes...>(current, line_end, delimiter, values, std::index_sequence_for<ColumnTypes...>{});
+        if (result.ec != std::errc{})
+        {
+          return {static_cast<std::size_t>(result.ptr - first), rows, result.ec};
+        }
+
+        [&]<std::size_t... Indices>(std::index_sequence<Indices...>) {
+          (std::get<Indices>(columns).emplace_back(std::move(std::get<Indices>(values))), ...);
+        }(std::index_sequence_for<ColumnTypes...>{});
+
+        ++rows;
+        current = next;
+      }
+
+      return {input.size(), rows, std::errc{}};
+    }
+
+  }  // namespace impl
+
+  template<nt::concepts::column_readable... ColumnTypes>
+    requires(sizeof...(ColumnTypes) > 0)
+  auto read_columns(std::string_view input, std::tuple<std::vector<ColumnTypes>...> & columns, column_format format = csv)
+      -> read_columns_result
+  {
+    auto skipped = std::size_t{};
+    if (format.header)
+    {
+      auto header_end = input.find('\n');
+      skipped = header_end == std::string_view::npos ? input.size() : header_end + 1;
+      input.remove_prefix(skipped);
+    }
+
+    auto result = impl::parse_rows(input, columns, format.delimiter);
+    result.offset += skipped;
+    return result;
+  }
+
+  template<nt::concepts::column_readable... ColumnTypes>
+    requires(sizeof...(ColumnTypes) > 0)
+  auto read_columns(std::string_view input, column_format format = csv) -> std::tuple<std::vector<ColumnTypes>...>
+  {
+    auto columns = std::tuple<std::vector<ColumnTypes>...>{};
+    auto result = read_columns(input, columns, format);
+    if (result.error != std::errc{})
+    {
+      throw read_error{result.error, result.offset};
+    }
+    return columns;
+  }
+
+#if __has_include(<unistd.h>)
+  template<nt::concepts::column_readable... ColumnTypes>
+    requires(sizeof...(ColumnTypes) > 0)
+  auto read_columns(int descriptor,
+                    std::tuple<std::vector<ColumnTypes>...> & columns,
+                    column_format format = csv,
+                    std::size_t chunk_size = 1 << 16) -> read_columns_result
+  {
+    auto buffer = std::vector<char>(std::max(chunk_size, std::size_t{1}));
+    auto filled = std::size_t{};
+    auto consumed_offset = std::size_t{};
+    auto rows = std::size_t{};
+    auto skip_header = format.header;
+
+    while (true)
+    {
+      auto count = ::read(descriptor, buffer.data() + filled, buffer.size() - filled);
+      if (count < 0)
+      {
+        if (errno == EINTR)
+        {
+          continue;
+        }
+        return {consumed_offset + filled, rows, static_cast<std::errc>(errno)};
+      }
+
+      filled += static_cast<std::size_t>(count);
+      if (count == 0 && filled == 0)
+      {
+        return {consumed_offset, rows, std::errc{}};
+      }
+
+      auto available = std::string_view{buffer.data(), filled};
+      auto portion_size = filled;
+      if (count != 0)
+      {
+        auto boundary = available.rfind('\n');
+        if (boundary == std::string_view::npos)
+        {
+          if (filled == buffer.size())
+          {
+            buffer.resize(buffer.size() * 2);
+          }
+          continue;
+        }
+        portion_size = boundary + 1;
+      }
+
+      auto portion = available.substr(0, portion_size);
+      auto skipped = std::size_t{};
+      if (skip_header)
+      {
+        auto header_end = portion.find('\n');
+        skipped = header_end == std::string_view::npos ? portion.size() : header_end + 1;
+        portion.remove_prefix(skipped);
+        skip_header = false;
+      }
+
+      auto result = impl::parse_rows(portion, columns, format.delimiter);
+      rows += result.rows;
+      if (result.error != std::errc{} || count == 0)
+      {
+        return {consumed_offset + skipped + result.offset, rows, result.error};
+      }
+
+      std::copy(buffer.begin() + static_cast<std::ptrdiff_t>(portion_size),
+                buffer.begin() + static_cast<std::ptrdiff_t>(filled),
+                buffer.begin());
+      consumed_offset += portion_size;
+      filled -= portion_size;
+    }
+  }
+
+  template<nt::concepts::column_readable... ColumnTypes>
+    requires(sizeof...(ColumnTypes) > 0)
+  auto read_columns(int descriptor, column_format format = csv, std::size_t chunk_size = 1 << 16) -> std::tuple<std::vector<ColumnTypes>...>
+  {
+    auto columns = std::tuple<std::vector<ColumnTypes>...>{};
+    auto result = read_columns(descriptor, columns, format, chunk_size);
+    if (result.error != std::errc{})
+    {
+      throw read_error{result.error, result.offset};
+    }
+    return columns;
+  }
+#endif
+
+}  // namespace nt
+
+#endif
@@ -0,0 +1,24 @@
+#ifndef NEWTYPE_SHOW_HPP
+#define NEWTYPE_SHOW_HPP
+
+#include "newtype/core.hpp"
+
+#include <ostream>
+
+namespace nt
+{
+
+  template<typename CharType,
+           typename StreamTraits,
+           nt::concepts::output_streamable<CharType, StreamTraits> BaseType,
+           typename TagType,
+           nt::derives<nt::Show> auto DerivationClause>
+  auto operator<<(std::basic_ostream<CharType, StreamTraits> & output, new_type<BaseType, TagType, DerivationClause> const & source) noexcept(
+      nt::concepts::nothrow_output_streamable<BaseType, CharType, StreamTraits>) -> std::basic_ostream<CharType, StreamTraits> &
+  {
+    return output << impl::new_type_access::value(source);
+  }
+
+}  // namespace nt
+
+#endif
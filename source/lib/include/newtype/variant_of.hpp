@@ -0,0 +1,309 @@
+#ifndef NEWTYPE_VARIANT_OF_HPP
+#define NEWTYPE_VARIANT_OF_HPP
+
+#include "newtype/core.hpp"
+#include "newtype/hash.hpp"
+
+#include <bit>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+namespace nt
+{
+
+  namespace concepts
+  {
+
+    inline namespace variants
+    {
+
+      template<typename SubjectType>
+      concept variant_alternative = requires {
+        typename SubjectType::base_type;
+        typename SubjectType::derivation_clause_type;
+        requires std::copy_constructible<SubjectType>;
+        requires std::constructible_from<SubjectType, typename SubjectType::base_type>;
+      };
+
+      template<typename... SubjectTypes>
+      concept shared_base = (std::same_as<typename SubjectTypes::base_type,
+                                          typename std::tuple_element_t<0, std::tuple<SubjectTypes...>>::base_type> &&
+                             ...);
+
+    }  // namespace variants
+
+  }  // namespace concepts
+
+  namespace impl
+  {
+
+    inline namespace variant_storage
+    {
+
+      template<typename NeedleType, typename... HaystackTypes>
+      auto constexpr alternative_index() noexcept -> std::size_t
+      {
+        auto index = std::size_t{};
+        auto found = ((std::is_same_v<NeedleType, HaystackTypes> ? true : (++index, false)) || ...);
+        return found ? index : sizeof...(HaystackTypes);
+      }
+
+      template<typename... Types>
+      auto constexpr all_distinct() noexcept -> bool
+      {
+        auto index = std::size_t{};
+        return ((alternative_index<Types, Types...>() == index++) && ...);
+      }
+
+      template<typename BaseType, std::size_t Alternatives, bool = std::unsigned_integral<BaseType> && !std::same_as<BaseType, bool>>
+      class discriminated_storage
+      {
+      public:
+        auto constexpr static packs_discriminator = false;
+        auto constexpr static discriminator_bits = std::size_t{8};
+
+        constexpr discriminated_storage(std::size_t index, BaseType value) noexcept(std::is_nothrow_move_constructible_v<BaseType>)
+            : m_value{std::move(value)}
+            , m_index{static_cast<std::uint8_t>(index)}
+        {
+        }
+
+        auto constexpr index() const noexcept -> std::size_t
+        {
+          return m_index;
+        }
+
+        auto constexpr value() const noexcept(std::is_nothrow_copy_constructible_v<BaseType>) -> BaseType
+        {
+          return m_value;
+        }
+
+      private:
+        BaseType m_value;
+        std::uint8_t m_index;
+      };
+
+      template<typename BaseType, std::size_t Alternatives>
+      class discriminated_storage<BaseType, Alternatives, true>
+      {
+        auto constexpr static shift = std::numeric_limits<BaseType>::digits - std::bit_width(Alternatives - 1);
+
+      public:
+        auto constexpr static packs_discriminator = true;
+        auto constexpr static discriminator_bits = static_cast<std::size_t>(std::bit_width(Alternatives - 1));
+        auto constexpr static value_mask = static_cast<BaseType>(std::numeric_limits<BaseType>::max() >> discriminator_bits);
+
+        constexpr discriminated_storage(std::size_t index, BaseType value)
+            : m_representation{pack(index, value)}
+        {
+        }
+
+        auto constexpr index() const noexcept -> std::size_t
+        {
+          return static_cast<std::size_t>(m_representation >> shift);
+        }
+
+        auto constexpr value() const noexcept -> BaseType
+        {
+          return static_cast<BaseType>(m_representation & value_mask);
+        }
+
+      private:
+        auto constexpr static pack(std::size_t index, BaseType value) -> BaseType
+        {
+          if (value > value_mask)
+          {
+            throw std::out_of_range{"nt::variant_of: value overlaps the discriminator bits"};
+          }
+          return static_cast<BaseType>(static_cast<BaseType>(index) << shift | value);
+        }
+
+        BaseType m_representation;
+      };
+
+    }  // namespace variant_storage
+
+    struct variant_access
+    {
+      template<typename AlternativeType, typename VariantType>
+      auto constexpr static value(VariantType const & variant) -> AlternativeType
+      {
+        return AlternativeType{variant.m_storage.value()};
+      }
+    };
+
+  }  // namespace impl
+
+  template<nt::concepts::variant_alternative... NewTypes>
+    requires(sizeof...(NewTypes) > 1 && sizeof...(NewTypes) <= 256 && nt::concepts::shared_base<NewTypes...> &&
+             impl::all_distinct<NewTypes...>())
+  class variant_of
+  {
+    using first_alternative = std::tuple_element_t<0, std::tuple<NewTypes...>>;
+    using storage_type = impl::discriminated_storage<typename first_alternative::base_type, sizeof...(NewTypes)>;
+
+  public:
+    using base_type = typename first_alternative::base_type;
+
+    auto constexpr static alternatives = sizeof...(NewTypes);
+    auto constexpr static packs_discriminator = storage_type::packs_discriminator;
+    auto constexpr static discriminator_bits = storage_type::discriminator_bits;
+
+    template<typename AlternativeType>
+    auto constexpr static index_of = impl::alternative_index<AlternativeType, NewTypes...>();
+
+    template<std::size_t Index>
+    using alternative_type = std::tuple_element_t<Index, std::tuple<NewTypes...>>;
+
+    constexpr variant_of() noexcept(std::is_nothrow_default_constructible_v<first_alternative> &&
+                                    std::is_nothrow_constructible_v<storage_type, std::size_t, base_type>)
+      requires std::default_initializable<first_alternative>
+        : variant_of{first_alternative{}}
+    {
+    }
+
+    template<typename AlternativeType>
+      requires(index_of<AlternativeType> < alternatives)
+    constexpr variant_of(AlternativeType const & value) noexcept(std::is_nothrow_constructible_v<storage_type, std::size_t, base_type>)
+        : m_storage{index_of<AlternativeType>, value.decay()}
+    {
+    }
+
+    auto constexpr index() const noexcept -> std::size_t
+    {
+      return m_storage.index();
+    }
+
+    template<typename AlternativeType>
+      requires(index_of<AlternativeType> < alternatives)
+    auto constexpr holds() const noexcept -> bool
+    {
+      return index() == index_of<AlternativeType>;
+    }
+
+    template<typename AlternativeType>
+      requires(index_of<AlternativeType> < alternatives)
+    auto constexpr get() const -> AlternativeType
+    {
+      if (!holds<AlternativeType>())
+      {
+        throw std::bad_variant_access{};
+      }
+      return AlternativeType{m_storage.value()};
+    }
+
+    template<std::size_t Index>
+      requires(Index < alternatives)
+    auto constexpr get() const -> alternative_type<Index>
+    {
+      return get<alternative_type<Index>>();
+    }
+
+  private:
+    friend struct impl::variant_access;
+
+    storage_type m_storage;
+  };
+
+  template<typename AlternativeType, typename... NewTypes>
+    requires(variant_of<NewTypes...>::template index_of<AlternativeType> < sizeof...(NewTypes))
+  auto constexpr holds_alternative(variant_of<NewTypes...> const & variant) noexcept -> bool
+  {
+    return variant.template holds<AlternativeType>();
+  }
+
+  template<typename AlternativeType, typename... NewTypes>
+    requires(variant_of<NewTypes...>::template index_of<AlternativeType> < sizeof...(NewTypes))
+  auto constexpr get(variant_of<NewTypes...> const & variant) -> AlternativeType
+  {
+    return variant.template get<AlternativeType>();
+  }
+
+  namespace impl
+  {
+
+    template<std::size_t Index, typename VisitorType, typename... NewTypes>
+    auto constexpr visit_from(VisitorType && visitor, variant_of<NewTypes...> const & variant) -> decltype(auto)
+    {
+      using alternative_type = typename variant_of<NewTypes...>::template alternative_type<Index>;
+
+      if constexpr (Index + 1 == sizeof...(NewTypes))
+      {
+        return std::invoke(std::forward<VisitorType>(visitor), variant_access::value<alternative_type>(variant));
+      }
+      else
+      {
+        if (variant.index() == Index)
+        {
+          return std::invoke(std::forward<VisitorType>(visitor), variant_access::value<alternative_type>(variant));
+        }
+        return visit_from<Index + 1>(std::forward<VisitorType>(visitor), variant);
+      }
+    }
+
+  }  // namespace impl
+
+  template<typename VisitorType, typename... NewTypes>
+    requires(std::invocable<VisitorType, NewTypes> && ...)
+  auto constexpr visit(VisitorType && visitor, variant_of<NewTypes...> const & variant) -> decltype(auto)
+  {
+    using result_type = std::invoke_result_t<VisitorType, std::tuple_element_t<0, std::tuple<NewTypes...>>>;
+    static_assert((std::is_same_v<result_type, std::invoke_result_t<VisitorType, NewTypes>> && ...),
+                  "nt::visit requires the visitor to return the same type for all alternatives");
+    return impl::visit_from<0>(std::forward<VisitorType>(visitor), variant);
+  }
+
+  template<typename... NewTypes>
+    requires(std::equality_comparable<NewTypes> && ...)
+  auto constexpr operator==(variant_of<NewTypes...> const & lhs, variant_of<NewTypes...> const & rhs) -> bool
+  {
+    return lhs.index() == rhs.index() &&
+           visit([&](auto const & value) { return value == impl::variant_access::value<std::remove_cvref_t<decltype(value)>>(rhs); }, lhs);
+  }
+
+  template<typename... NewTypes>
+    requires((nt::derives<typename NewTypes::derivation_clause_type, nt::Relational> && ...) &&
+             std::three_way_comparable<typename variant_of<NewTypes...>::base_type>)
+  auto constexpr operator<=>(variant_of<NewTypes...> const & lhs, variant_of<NewTypes...> const & rhs)
+      -> std::compare_three_way_result_t<typename variant_of<NewTypes...>::base_type>
+  {
+    if (lhs.index() != rhs.index())
+    {
+      return lhs.index() <=> rhs.index();
+    }
+    return visit(
+        [&](auto const & value) {
+          using alternative_type = std::remove_cvref_t<decltype(value)>;
+          return value.decay() <=> impl::variant_access::value<alternative_type>(rhs).decay();
+        },
+        lhs);
+  }
+
+}  // namespace nt
+
+namespace std
+{
+
+  template<typename... NewTypes>
+    requires(nt::derives<typename NewTypes::derivation_clause_type, nt::Hash> && ...)
+  struct hash<nt::variant_of<NewTypes...>>
+  {
+    auto constexpr operator()(nt::variant_of<NewTypes...> const & variant) const -> std::size_t
+    {
+      auto value_hash = nt::visit([](auto const & value) { return std::hash<std::remove_cvref_t<decltype(value)>>{}(value); }, variant);
+      return value_hash ^ (variant.index() + 0x9e3779b9 + (value_hash << 6) + (value_hash >> 2));
+    }
+  };
+
+}  // namespace std
+
+#endif
@@ -0,0 +1,200 @@
+#ifndef NEWTYPE_WRITE_ALL_HPP
+#define NEWTYPE_WRITE_ALL_HPP
+
+#include "newtype/core.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <concepts>
+#include <cstddef>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#if __has_include(<unistd.h>)
+#include <cerrno>
+
+#include <unistd.h>
+#endif
+
+namespace nt
+{
+
+  namespace impl
+  {
+
+    namespace to_chars_lookup
+    {
+
+      using std::to_chars;
+
+      template<typename SubjectType>
+      concept formattable = requires(char * first, char * last, SubjectType const & value) {
+        { to_chars(first, last, value) } -> std::same_as<std::to_chars_result>;
+      };
+
+      template<formattable SubjectType>
+      auto format(char * first, char * last, SubjectType const & value) -> std::to_chars_result
+      {
+        return to_chars(first, last, value);
+      }
+
+    }  // namespace to_chars_lookup
+
+  }  // namespace impl
+
+  namespace concepts
+  {
+
+    inline namespace bulk_output
+    {
+
+      template<typename SubjectType>
+      concept to_chars_formattable = impl::to_chars_lookup::formattable<SubjectType>;
+
+      template<typename SubjectType>
+      concept bulk_writable = requires {
+        typename SubjectType::base_type;
+        typename SubjectType::derivation_clause_type;
+        requires nt::derives<typename SubjectType::derivation_clause_type, nt::Show>;
+        requires to_chars_formattable<typename SubjectType::base_type>;
+      };
+
+    }  // namespace bulk_output
+
+  }  // namespace concepts
+
+  struct write_all_result
+  {
+    std::size_t size;
+    std::errc error;
+  };
+
+  namespace impl
+  {
+
+    auto constexpr minimum_write_buffer_size = std::size_t{256};
+
+    template<typename RangeType, typename BufferType, typename MakeRoomFunction>
+    auto write_all_buffered(RangeType && values, char separator, BufferType & buffer, std::size_t & position, MakeRoomFunction make_room)
+        -> std::errc
+    {
+      auto first = true;
+
+      for (auto const & value : values)
+      {
+        auto const & base = new_type_access::value(value);
+        auto const separator_size = std::size_t{!first};
+
+        if (buffer.size() - position < minimum_write_buffer_size)
+        {
+          if (auto error = make_room(position); error != std::errc{})
+          {
+            return error;
+          }
+        }
+
+        while (true)
+        {
+          if (buffer.size() - position > separator_size)
+          {
+            auto [end, error] = to_chars_lookup::format(buffer.data() + position + separator_size, buffer.data() + buffer.size(), base);
+            if (error == std::errc{})
+            {
+              if (separator_size)
+              {
+                buffer[position] = separator;
+              }
+              position = static_cast<std::size_t>(end - buffer.data());
+              break;
+            }
+            if (error != std::errc::value_too_large)
+            {
+              return error;
+            }
+          }
+
+          if (auto error = make_room(position); error != std::errc{})
+          {
+            return error;
+          }
+        }
+
+        first = false;
+      }
+
+      return std::errc{};
+    }
+
+  }  // namespace impl
+
+  template<std::ranges::input_range RangeType>
+    requires nt::concepts::bulk_writable<std::ranges::range_value_t<RangeType>>
+  auto write_all(RangeType && values, std::string & sink, char separator = '\n') -> write_all_result
+  {
+    auto const initial_size = sink.size();
+    auto position = initial_size;
+    sink.resize(std::max(sink.capacity(), initial_size + impl::minimum_write_buffer_size));
+
+    auto error = impl::write_all_buffered(std::forward<RangeType>(values), separator, sink, position, [&](std::size_t used) {
+      sink.resize(std::max(2 * sink.size(), used + impl::minimum_write_buffer_size));
+      return std::errc{};
+    });
+
+    sink.resize(position);
+    return {position - initial_size, error};
+  }
+
+#if __has_include(<unistd.h>)
+  template<std::ranges::input_range RangeType>
+    requires nt::concepts::bulk_writable<std::ranges::range_value_t<RangeType>>
+  auto write_all(RangeType && values, int descriptor, char separator = '\n', std::size_t buffer_size = 1 << 16) -> write_all_result
+  {
+    auto buffer = std::vector<char>(std::max(buffer_size, 2 * impl::minimum_write_buffer_size));
+    auto position = std::size_t{};
+    auto result = write_all_result{0, std::errc{}};
+
+    auto flush = [&](std::string_view chunk) {
+      while (!chunk.empty())
+      {
+        auto count = ::write(descriptor, chunk.data(), chunk.size());
+        if (count < 0)
+        {
+          if (errno == EINTR)
+          {
+            continue;
+          }
+          return static_cast<std::errc>(errno);
+        }
+        result.size += static_cast<std::size_t>(count);
+        chunk.remove_prefix(static_cast<std::size_t>(count));
+      }
+      return std::errc{};
+    };
+
+    result.error = impl::write_all_buffered(std::forward<RangeType>(values), separator, buffer, position, [&](std::size_t & used) {
+      if (used == 0)
+      {
+        buffer.resize(2 * buffer.size());
+        return std::errc{};
+      }
+      auto error = flush(std::string_view{buffer.data(), used});
+      used = 0;
+      return error;
+    });
+
+    if (result.error == std::errc{})
+    {
+      result.error = flush(std::string_view{buffer.data(), position});
+    }
+
+    return result;
+  }
+#endif
+
+}  // namespace nt
+
+#endif
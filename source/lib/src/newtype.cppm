@@ -0,0 +1,251 @@
+module;
+
+#include "newtype/accounted.hpp"
+#include "newtype/allocator.hpp"
+#include "newtype/copy_audit.hpp"
+#include "newtype/default_init_allocator.hpp"
+#include "newtype/fixed_string.hpp"
+#include "newtype/indexed_vector.hpp"
+#include "newtype/instrumented.hpp"
+#include "newtype/interned.hpp"
+#include "newtype/newtype.hpp"
+#include "newtype/optional.hpp"
+#include "newtype/packed.hpp"
+#include "newtype/read_all.hpp"
+#include "newtype/read_columns.hpp"
+#include "newtype/variant_of.hpp"
+#include "newtype/write_all.hpp"
+
+export module newtype;
+
+export namespace nt
+{
+
+  using nt::derivable;
+  using nt::derivation_clause;
+  using nt::derives;
+  using nt::deriving;
+  using nt::make;
+  using nt::new_type;
+  using nt::version;
+
+  using nt::Accounted;
+  using nt::Arithmetic;
+  using nt::CachedHash;
+  using nt::Container;
+  using nt::DefaultInit;
+  using nt::EqBase;
+  using nt::Hash;
+  using nt::ImplicitConversion;
+  using nt::Index;
+  using nt::Indirection;
+  using nt::Instrumented;
+  using nt::Iterable;
+  using nt::MoveOnly;
+  using nt::Read;
+  using nt::Relational;
+  using nt::Sentinel;
+  using nt::sentinel_tag;
+  using nt::Show;
+  using nt::Subscript;
+
+  using nt::operator==;
+  using nt::operator!=;
+  using nt::operator<;
+  using nt::operator>;
+  using nt::operator<=;
+  using nt::operator>=;
+  using nt::operator<=>;
+  using nt::operator<<;
+  using nt::operator>>;
+  using nt::operator+;
+  using nt::operator-;
+  using nt::operator*;
+  using nt::operator/;
+  using nt::operator+=;
+  using nt::operator-=;
+  using nt::operator*=;
+  using nt::operator/=;
+  using nt::operator++;
+  using nt::operator--;
+
+  using nt::begin;
+  using nt::cbegin;
+  using nt::crbegin;
+  using nt::rbegin;
+  using nt::end;
+  using nt::cend;
+  using nt::crend;
+  using nt::rend;
+
+  using nt::column_format;
+  using nt::csv;
+  using nt::default_init_allocator;
+  using nt::fixed_string;
+  using nt::get;
+  using nt::holds_alternative;
+  using nt::indexed_vector;
+  using nt::indices;
+  using nt::interned;
+  using nt::no_copies_scope;
+  using nt::optional;
+  using nt::packed;
+  using nt::packed_be;
+  using nt::packed_le;
+  using nt::read_all;
+  using nt::read_all_result;
+  using nt::read_columns;
+  using nt::read_columns_result;
+  using nt::read_error;
+  using nt::swap;
+  using nt::tsv;
+  using nt::variant_of;
+  using nt::visit;
+  using nt::write_all;
+  using nt::write_all_result;
+
+}  // namespace nt
+
+export namespace nt::accounting
+{
+
+  using nt::accounting::enable_peak_tracking;
+  using nt::accounting::resource;
+  using nt::accounting::snapshot;
+  using nt::accounting::statistics;
+
+}  // namespace nt::accounting
+
+export namespace nt::instrumentation
+{
+
+  using nt::instrumentation::counters;
+  using nt::instrumentation::reset;
+  using nt::instrumentation::snapshot;
+
+}  // namespace nt::instrumentation
+
+#if defined(NEWTYPE_AUDIT_COPIES)
+export namespace nt::copy_audit
+{
+
+  using nt::copy_audit::entry;
+  using nt::copy_audit::report;
+  using nt::copy_audit::reset;
+  using nt::copy_audit::set_violation_handler;
+  using nt::copy_audit::snapshot;
+  using nt::copy_audit::violation_handler;
+
+}  // namespace nt::copy_audit
+#endif
+
+export namespace nt::concepts
+{
+
+    using nt::concepts::addable;
+    using nt::concepts::advanceable;
+    using nt::concepts::beginnable;
+    using nt::concepts::bulk_readable;
+    using nt::concepts::bulk_writable;
+    using nt::concepts::cbeginnable;
+    using nt::concepts::cendable;
+    using nt::concepts::column_readable;
+    using nt::concepts::compound_addable;
+    using nt::concepts::compound_divisible;
+    using nt::concepts::compound_multipliable;
+    using nt::concepts::compound_subtractable;
+    using nt::concepts::const_beginnable;
+    using nt::concepts::const_endable;
+    using nt::concepts::const_free_begin;
+    using nt::concepts::const_free_end;
+    using nt::concepts::const_free_rbegin;
+    using nt::concepts::const_free_rend;
+    using nt::concepts::const_member_begin;
+    using nt::concepts::const_member_data;
+    using nt::concepts::const_member_end;
+    using nt::concepts::const_member_rbegin;
+    using nt::concepts::const_member_rend;
+    using nt::concepts::const_member_subscript;
+    using nt::concepts::const_rbeginnable;
+    using nt::concepts::const_rendable;
+    using nt::concepts::crbeginnable;
+    using nt::concepts::crendable;
+    using nt::concepts::decrementable;
+    using nt::concepts::divisible;
+    using nt::concepts::endable;
+    using nt::concepts::equality_comparable;
+    using nt::concepts::free_begin;
+    using nt::concepts::free_cbegin;
+    using nt::concepts::free_cend;
+    using nt::concepts::free_crbegin;
+    using nt::concepts::free_crend;
+    using nt::concepts::free_end;
+    using nt::concepts::free_rbegin;
+    using nt::concepts::free_rend;
+    using nt::concepts::from_chars_parsable;
+    using nt::concepts::fully_representable;
+    using nt::concepts::greater_than_comparable;
+    using nt::concepts::greater_than_equal_comparable;
+    using nt::concepts::hashable;
+    using nt::concepts::incrementable;
+    using nt::concepts::inequality_comparable;
+    using nt::concepts::input_streamable;
+    using nt::concepts::less_than_comparable;
+    using nt::concepts::less_than_equal_comparable;
+    using nt::concepts::member_begin;
+    using nt::concepts::member_capacity;
+    using nt::concepts::member_cbegin;
+    using nt::concepts::member_cend;
+    using nt::concepts::member_clear;
+    using nt::concepts::member_copy_push_back;
+    using nt::concepts::member_crbegin;
+    using nt::concepts::member_crend;
+    using nt::concepts::member_data;
+    using nt::concepts::member_emplace_back;
+    using nt::concepts::member_empty;
+    using nt::concepts::member_end;
+    using nt::concepts::member_move_push_back;
+    using nt::concepts::member_rbegin;
+    using nt::concepts::member_rend;
+    using nt::concepts::member_reserve;
+    using nt::concepts::member_resize;
+    using nt::concepts::member_resize_with_value;
+    using nt::concepts::member_size;
+    using nt::concepts::member_subscript;
+    using nt::concepts::multipliable;
+    using nt::concepts::nothrow_addable;
+    using nt::concepts::nothrow_advanceable;
+    using nt::concepts::nothrow_compound_addable;
+    using nt::concepts::nothrow_compound_divisible;
+    using nt::concepts::nothrow_compound_multipliable;
+    using nt::concepts::nothrow_compound_subtractable;
+    using nt::concepts::nothrow_decrementable;
+    using nt::concepts::nothrow_divisible;
+    using nt::concepts::nothrow_equality_comparable;
+    using nt::concepts::nothrow_greater_than_comparable;
+    using nt::concepts::nothrow_greater_than_equal_comparable;
+    using nt::concepts::nothrow_incrementable;
+    using nt::concepts::nothrow_inequality_comparable;
+    using nt::concepts::nothrow_input_streamable;
+    using nt::concepts::nothrow_less_than_comparable;
+    using nt::concepts::nothrow_less_than_equal_comparable;
+    using nt::concepts::nothrow_multipliable;
+    using nt::concepts::nothrow_output_streamable;
+    using nt::concepts::nothrow_subtractable;
+    using nt::concepts::output_streamable;
+    using nt::concepts::packable;
+    using nt::concepts::rbeginnable;
+    using nt::concepts::rendable;
+    using nt::concepts::sentinel_reserving;
+    using nt::concepts::shared_base;
+    using nt::concepts::strong_index;
+    using nt::concepts::subtractable;
+    using nt::concepts::to_chars_formattable;
+    using nt::concepts::variant_alternative;
+
+#if __cpp_multidimensional_subscript >= 202110L
+    using nt::concepts::const_member_multidimensional_subscript;
+    using nt::concepts::member_multidimensional_subscript;
+#endif
+
+}  // namespace nt::concepts
@@ -0,0 +1,183 @@
+#include "newtype/accounted.hpp"
+#include "newtype/newtype.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstddef>
+#include <memory_resource>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace accounting_types
+{
+
+  struct customer_name_tag;
+  using customer_name = nt::new_type<std::pmr::string, customer_name_tag, deriving(nt::Accounted, nt::Indirection)>;
+
+  struct product_name_tag;
+  using product_name = nt::new_type<std::pmr::string, product_name_tag, deriving(nt::Accounted)>;
+
+  struct supplier_name_tag;
+  using supplier_name = nt::new_type<std::pmr::string, supplier_name_tag, deriving(nt::Accounted)>;
+
+  struct samples_tag;
+  using samples = nt::new_type<std::pmr::vector<int>, samples_tag, deriving(nt::Accounted, nt::Indirection)>;
+
+  using plain_name = nt::new_type<std::pmr::string, struct plain_name_tag>;
+
+  auto constexpr long_text = "a string that is definitely too long for the small string optimization";
+
+}  // namespace accounting_types
+
+template<>
+auto constexpr nt::accounting::enable_peak_tracking<accounting_types::customer_name_tag> = true;
+
+template<>
+auto constexpr nt::accounting::enable_peak_tracking<accounting_types::samples_tag> = true;
+
+SCENARIO("Allocation Accounting", "[accounting]")
+{
+  using accounting_types::customer_name;
+  using accounting_types::customer_name_tag;
+  using accounting_types::long_text;
+  using accounting_types::product_name_tag;
+  using accounting_types::samples;
+  using accounting_types::samples_tag;
+
+  GIVEN("A new_type not deriving nt::Accounted")
+  {
+    THEN("it has the same size as its base type")
+    {
+      STATIC_REQUIRE(sizeof(accounting_types::plain_name) == sizeof(std::pmr::string));
+    }
+
+    THEN("it is constructed using the allocator of a pmr container")
+    {
+      STATIC_REQUIRE(std::uses_allocator_v<accounting_types::plain_name, std::pmr::polymorphic_allocator<>>);
+    }
+  }
+
+  GIVEN("A new_type deriving nt::Accounted")
+  {
+    THEN("it has the same size as its base type")
+    {
+      STATIC_REQUIRE(sizeof(customer_name) == sizeof(std::pmr::string));
+    }
+
+    THEN("it is not constructed using the allocator of a pmr container")
+    {
+      STATIC_REQUIRE_FALSE(std::uses_allocator_v<customer_name, std::pmr::polymorphic_allocator<>>);
+    }
+
+    THEN("it is not constructible using a different allocator")
+    {
+      STATIC_REQUIRE_FALSE(std::is_constructible_v<customer_name, std::allocator_arg_t, std::pmr::polymorphic_allocator<>, char const *>);
+      STATIC_REQUIRE_FALSE(
+          std::is_constructible_v<customer_name, std::allocator_arg_t, std::pmr::polymorphic_allocator<>, customer_name const &>);
+      STATIC_REQUIRE_FALSE(std::is_constructible_v<customer_name, std::allocator_arg_t, std::pmr::polymorphic_allocator<>, customer_name &&>);
+    }
+
+    WHEN("an object is constructed")
+    {
+      auto before = nt::accounting::snapshot<customer_name_tag>();
+      auto value = customer_name{long_text};
+
+      THEN("its base object allocates from the resource of its tag type")
+      {
+        REQUIRE(value->get_allocator().resource() == nt::accounting::resource<customer_name_tag>());
+      }
+
+      THEN("the allocation is accounted to its tag type")
+      {
+        auto after = nt::accounting::snapshot<customer_name_tag>();
+        REQUIRE(after.allocations == before.allocations + 1);
+        REQUIRE(after.live_bytes > before.live_bytes);
+        REQUIRE(after.peak_bytes >= after.live_bytes);
+      }
+
+      THEN("no allocation is accounted to other tag types")
+      {
+        REQUIRE(nt::accounting::snapshot<product_name_tag>().allocations == 0);
+      }
+    }
+
+    WHEN("an object of a tag type without peak tracking allocates")
+    {
+      auto value = accounting_types::supplier_name{long_text};
+      auto after = nt::accounting::snapshot<accounting_types::supplier_name_tag>();
+
+      THEN("the live bytes are accounted")
+      {
+        REQUIRE(after.live_bytes > 0);
+      }
+
+      THEN("the peak is not tracked")
+      {
+        REQUIRE(after.peak_bytes == 0);
+      }
+    }
+
+    WHEN("an object is copied")
+    {
+      auto original = customer_name{long_text};
+      auto before = nt::accounting::snapshot<customer_name_tag>();
+      auto copy = original;
+
+      THEN("the copy allocates from the resource of its tag type")
+      {
+        REQUIRE(copy->get_allocator().resource() == nt::accounting::resource<customer_name_tag>());
+        REQUIRE(nt::accounting::snapshot<customer_name_tag>().allocations == before.allocations + 1);
+      }
+    }
+
+    WHEN("an object is destroyed")
+    {
+      auto before = nt::accounting::snapshot<customer_name_tag>();
+      {
+        auto value = customer_name{long_text};
+        static_cast<void>(value);
+      }
+      auto after = nt::accounting::snapshot<customer_name_tag>();
+
+      THEN("its memory is no longer accounted as live")
+      {
+        REQUIRE(after.live_bytes == before.live_bytes);
+        REQUIRE(after.deallocations == before.deallocations + 1);
+      }
+    }
+
+    WHEN("objects are stored in a pmr container using a different resource")
+    {
+      auto buffer = std::pmr::monotonic_buffer_resource{};
+      auto values = std::pmr::vector<samples>{&buffer};
+      auto before = nt::accounting::snapshot<samples_tag>();
+      values.emplace_back(std::pmr::vector<int>(100));
+      values.emplace_back(std::pmr::vector<int>(100));
+
+      THEN("their base objects allocate from the resource of their tag type")
+      {
+        REQUIRE(values[0]->get_allocator().resource() == nt::accounting::resource<samples_tag>());
+        REQUIRE(nt::accounting::snapshot<samples_tag>().live_bytes >= before.live_bytes + 200 * sizeof(int));
+      }
+    }
+
+    WHEN("objects are created and destroyed repeatedly")
+    {
+      auto before = nt::accounting::snapshot<samples_tag>();
+      for (auto round = 0; round < 3; ++round)
+      {
+        auto value = samples{std::pmr::vector<int>(1000)};
+        static_cast<void>(value);
+      }
+      auto after = nt::accounting::snapshot<samples_tag>();
+
+      THEN("the peak exceeds the live bytes")
+      {
+        REQUIRE(after.live_bytes == before.live_bytes);
+        REQUIRE(after.peak_bytes >= before.live_bytes + 1000 * sizeof(int));
+      }
+    }
+  }
+}
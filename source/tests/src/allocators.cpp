@@ -0,0 +1,135 @@
+#include "newtype/allocator.hpp"
+#include "newtype/newtype.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <memory_resource>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace allocator_types
+{
+
+  struct default_resource_guard
+  {
+    default_resource_guard()
+        : m_previous{std::pmr::set_default_resource(std::pmr::null_memory_resource())}
+    {
+    }
+
+    ~default_resource_guard()
+    {
+      std::pmr::set_default_resource(m_previous);
+    }
+
+    default_resource_guard(default_resource_guard const &) = delete;
+    auto operator=(default_resource_guard const &) -> default_resource_guard & = delete;
+
+  private:
+    std::pmr::memory_resource * m_previous;
+  };
+
+  auto constexpr long_text = "a string that is definitely too long to fit into the small buffer";
+
+}  // namespace allocator_types
+
+SCENARIO("Allocator Awareness", "[allocators]")
+{
+  GIVEN("A new_type over an allocator-aware type")
+  {
+    using type_alias = nt::new_type<std::pmr::string, struct tag>;
+
+    THEN("it has the same allocator type as the base type")
+    {
+      STATIC_REQUIRE(std::is_same_v<typename type_alias::allocator_type, std::pmr::string::allocator_type>);
+    }
+
+    THEN("it uses the same allocators as the base type")
+    {
+      STATIC_REQUIRE(std::uses_allocator_v<type_alias, std::pmr::polymorphic_allocator<char>>);
+      STATIC_REQUIRE(std::uses_allocator_v<type_alias, std::pmr::memory_resource *>);
+    }
+
+    THEN("it is constructible with a leading allocator")
+    {
+      STATIC_REQUIRE(std::is_constructible_v<type_alias, std::allocator_arg_t, std::pmr::polymorphic_allocator<char>, char const *>);
+      STATIC_REQUIRE(std::is_constructible_v<type_alias, std::allocator_arg_t, std::pmr::polymorphic_allocator<char>, type_alias const &>);
+      STATIC_REQUIRE(std::is_constructible_v<type_alias, std::allocator_arg_t, std::pmr::polymorphic_allocator<char>, type_alias &&>);
+    }
+  }
+
+  GIVEN("A new_type over a type that is not allocator-aware")
+  {
+    using type_alias = nt::new_type<int, struct tag>;
+
+    THEN("it does not use allocators")
+    {
+      STATIC_REQUIRE_FALSE(std::uses_allocator_v<type_alias, std::allocator<int>>);
+    }
+
+    THEN("it is not constructible with a leading allocator")
+    {
+      STATIC_REQUIRE_FALSE(std::is_constructible_v<type_alias, std::allocator_arg_t, std::allocator<int>, int>);
+    }
+  }
+
+  GIVEN("A new_type over a type using uses_allocator without an allocator_type")
+  {
+    using type_alias = nt::new_type<std::tuple<std::pmr::string>, struct tag>;
+
+    THEN("it uses the same allocators as the base type")
+    {
+      STATIC_REQUIRE(std::uses_allocator_v<type_alias, std::pmr::polymorphic_allocator<char>>);
+    }
+  }
+
+  GIVEN("A memory resource and a guard against allocations from the default resource")
+  {
+    using type_alias = nt::new_type<std::pmr::string, struct tag, deriving(nt::Indirection)>;
+
+    auto buffer = std::array<std::byte, 4096>{};
+    auto arena = std::pmr::monotonic_buffer_resource{buffer.data(), buffer.size(), std::pmr::null_memory_resource()};
+    auto guard = allocator_types::default_resource_guard{};
+
+    THEN("objects emplaced into a std::pmr::vector allocate from the memory resource")
+    {
+      auto values = std::pmr::vector<type_alias>{&arena};
+      values.reserve(4);
+      values.emplace_back(allocator_types::long_text);
+      values.emplace_back();
+      values.push_back(values.front());
+
+      REQUIRE(values.size() == 3);
+      REQUIRE(values[0]->get_allocator().resource() == &arena);
+      REQUIRE(values[1]->get_allocator().resource() == &arena);
+      REQUIRE(values[2]->get_allocator().resource() == &arena);
+      REQUIRE(values[2]->compare(allocator_types::long_text) == 0);
+    }
+
+    THEN("objects inserted into a std::pmr::map allocate from the memory resource")
+    {
+      auto values = std::pmr::map<int, type_alias>{&arena};
+      values.emplace(1, allocator_types::long_text);
+      values.try_emplace(2, allocator_types::long_text);
+
+      REQUIRE(values.at(1)->get_allocator().resource() == &arena);
+      REQUIRE(values.at(2)->get_allocator().resource() == &arena);
+    }
+
+    THEN("allocator-extended copy construction uses the given allocator")
+    {
+      auto original = type_alias{std::allocator_arg, &arena, allocator_types::long_text};
+      auto copy = type_alias{std::allocator_arg, &arena, original};
+
+      REQUIRE(copy->get_allocator().resource() == &arena);
+      REQUIRE(copy->compare(allocator_types::long_text) == 0);
+    }
+  }
+}
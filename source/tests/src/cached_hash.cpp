@@ -0,0 +1,290 @@
+#include "newtype/newtype.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace cached_hash_types
+{
+
+  template<typename SubjectType>
+  concept hashable = requires(SubjectType subject) { std::hash<SubjectType>{}(subject); };
+
+  template<typename SubjectType>
+  concept mutably_iterable = requires(SubjectType & subject) {
+    { subject.begin() } -> std::same_as<typename SubjectType::iterator>;
+  };
+
+  template<typename SubjectType>
+  concept mutably_indirectable = requires(SubjectType & subject) {
+    { subject.operator->() } -> std::same_as<typename SubjectType::base_type *>;
+  };
+
+  template<typename SubjectType>
+  concept push_backable = requires(SubjectType & subject, typename SubjectType::base_type::value_type value) { subject.push_back(value); };
+
+  auto constexpr long_text = "a string that is definitely too long to fit into the small buffer";
+
+  struct counted_key
+  {
+    int value;
+
+    auto constexpr operator==(counted_key const &) const noexcept -> bool = default;
+  };
+
+  inline auto hasher_calls = std::size_t{};
+
+}  // namespace cached_hash_types
+
+namespace std
+{
+  template<>
+  struct hash<cached_hash_types::counted_key>
+  {
+    auto operator()(cached_hash_types::counted_key const & key) const noexcept -> std::size_t
+    {
+      ++cached_hash_types::hasher_calls;
+      return std::hash<int>{}(key.value);
+    }
+  };
+}  // namespace std
+
+SCENARIO("Cached Hash", "[hash]")
+{
+  GIVEN("A new_type deriving nt::CachedHash")
+  {
+    using type_alias = nt::new_type<std::string, struct tag, deriving(nt::CachedHash)>;
+
+    THEN("it is hashable")
+    {
+      STATIC_REQUIRE(cached_hash_types::hashable<type_alias>);
+    }
+
+    THEN("it stores the hash next to the contained object")
+    {
+      STATIC_REQUIRE(sizeof(type_alias) == sizeof(std::string) + sizeof(std::size_t));
+    }
+
+    THEN("a new_type not deriving nt::CachedHash does not store the hash")
+    {
+      STATIC_REQUIRE(sizeof(nt::new_type<std::string, struct tag, deriving(nt::Hash)>) == sizeof(std::string));
+    }
+  }
+
+  GIVEN("A new_type over a non-hashable type deriving nt::CachedHash")
+  {
+    using type_alias = nt::new_type<std::vector<int>, struct tag, deriving(nt::CachedHash)>;
+
+    THEN("it is not hashable")
+    {
+      STATIC_REQUIRE_FALSE(cached_hash_types::hashable<type_alias>);
+    }
+  }
+
+  GIVEN("An object of a new_type deriving nt::CachedHash")
+  {
+    using type_alias = nt::new_type<std::string, struct tag, deriving(nt::CachedHash)>;
+    auto object = type_alias{cached_hash_types::long_text};
+
+    THEN("its hash is equal to the hash of the contained object")
+    {
+      REQUIRE(std::hash<type_alias>{}(object) == std::hash<std::string>{}(cached_hash_types::long_text));
+    }
+
+    THEN("an in-place constructed object has the same hash")
+    {
+      auto other = type_alias{std::in_place, cached_hash_types::long_text};
+      REQUIRE(std::hash<type_alias>{}(other) == std::hash<type_alias>{}(object));
+    }
+
+    THEN("it compares equal to an object with the same value")
+    {
+      REQUIRE(object == type_alias{cached_hash_types::long_text});
+    }
+
+    THEN("it compares unequal to an object with a different value")
+    {
+      REQUIRE(object != type_alias{"other"});
+      REQUIRE_FALSE(object == type_alias{"other"});
+    }
+
+    WHEN("it is moved from")
+    {
+      auto target = std::move(object);
+
+      THEN("the target has the hash of the original value")
+      {
+        REQUIRE(std::hash<type_alias>{}(target) == std::hash<std::string>{}(cached_hash_types::long_text));
+      }
+
+      THEN("the moved-from object is hashed again when it is assigned a new value")
+      {
+        object = type_alias{"other"};
+        REQUIRE(std::hash<type_alias>{}(object) == std::hash<std::string>{}("other"));
+      }
+    }
+
+    WHEN("another object is move assigned to it")
+    {
+      auto source = type_alias{"source"};
+      object = std::move(source);
+
+      THEN("its hash is updated")
+      {
+        REQUIRE(std::hash<type_alias>{}(object) == std::hash<std::string>{}("source"));
+      }
+
+      THEN("the moved-from object is hashed again when it is assigned a new value")
+      {
+        source = type_alias{"other"};
+        REQUIRE(std::hash<type_alias>{}(source) == std::hash<std::string>{}("other"));
+      }
+    }
+
+    THEN("it can be used as a key in an unordered container")
+    {
+      auto set = std::unordered_set<type_alias>{object, type_alias{"other"}, type_alias{cached_hash_types::long_text}};
+      REQUIRE(set.size() == 2);
+      REQUIRE(set.contains(type_alias{"other"}));
+    }
+  }
+
+  GIVEN("Objects of a new_type deriving nt::CachedHash over a type with a counting hasher")
+  {
+    using type_alias = nt::new_type<cached_hash_types::counted_key, struct tag, deriving(nt::CachedHash)>;
+    auto object = type_alias{cached_hash_types::counted_key{42}};
+    auto other = type_alias{cached_hash_types::counted_key{21}};
+    cached_hash_types::hasher_calls = 0;
+
+    WHEN("they are moved around")
+    {
+      auto target = std::move(object);
+      other = std::move(target);
+      std::swap(object, other);
+
+      THEN("the hasher is not called")
+      {
+        REQUIRE(cached_hash_types::hasher_calls == 0);
+      }
+
+      THEN("the cached hash follows the value")
+      {
+        REQUIRE(std::hash<type_alias>{}(object) == std::hash<int>{}(42));
+      }
+    }
+
+    WHEN("one of them is copied")
+    {
+      auto copy = object;
+
+      THEN("the hasher is not called")
+      {
+        REQUIRE(cached_hash_types::hasher_calls == 0);
+        REQUIRE(copy == object);
+      }
+    }
+
+    WHEN("a new object is constructed")
+    {
+      auto created = type_alias{cached_hash_types::counted_key{7}};
+
+      THEN("the hasher is called once")
+      {
+        REQUIRE(cached_hash_types::hasher_calls == 1);
+        REQUIRE(std::hash<type_alias>{}(created) == std::hash<int>{}(7));
+      }
+    }
+  }
+
+  GIVEN("An object of a new_type deriving nt::CachedHash and nt::Arithmetic")
+  {
+    using type_alias = nt::new_type<int, struct tag, deriving(nt::CachedHash, nt::Arithmetic)>;
+    auto object = type_alias{20};
+
+    WHEN("it is modified using compound assignment")
+    {
+      object += type_alias{22};
+
+      THEN("its hash is updated")
+      {
+        REQUIRE(std::hash<type_alias>{}(object) == std::hash<int>{}(42));
+      }
+    }
+  }
+
+  GIVEN("An object of a new_type deriving nt::CachedHash and nt::Index")
+  {
+    using type_alias = nt::new_type<int, struct tag, deriving(nt::CachedHash, nt::Index)>;
+    auto object = type_alias{41};
+
+    WHEN("it is incremented")
+    {
+      ++object;
+
+      THEN("its hash is updated")
+      {
+        REQUIRE(std::hash<type_alias>{}(object) == std::hash<int>{}(42));
+      }
+    }
+  }
+
+  GIVEN("An object of a new_type deriving nt::CachedHash and nt::Read")
+  {
+    using type_alias = nt::new_type<int, struct tag, deriving(nt::CachedHash, nt::Read)>;
+    auto object = type_alias{};
+
+    WHEN("it is read from an input stream")
+    {
+      auto input = std::istringstream{"42"};
+      input >> object;
+
+      THEN("its hash is updated")
+      {
+        REQUIRE(std::hash<type_alias>{}(object) == std::hash<int>{}(42));
+      }
+    }
+  }
+
+  GIVEN("A new_type deriving nt::CachedHash, nt::Iterable, nt::Indirection, and nt::Container")
+  {
+    using type_alias = nt::new_type<std::string, struct tag, deriving(nt::CachedHash, nt::Iterable, nt::Indirection, nt::Container)>;
+    using uncached_type_alias = nt::new_type<std::string, struct tag, deriving(nt::Iterable, nt::Indirection, nt::Container)>;
+
+    THEN("it does not provide mutable iterators")
+    {
+      STATIC_REQUIRE(cached_hash_types::mutably_iterable<uncached_type_alias>);
+      STATIC_REQUIRE_FALSE(cached_hash_types::mutably_iterable<type_alias>);
+    }
+
+    THEN("it does not provide mutable indirection")
+    {
+      STATIC_REQUIRE(cached_hash_types::mutably_indirectable<uncached_type_alias>);
+      STATIC_REQUIRE_FALSE(cached_hash_types::mutably_indirectable<type_alias>);
+    }
+
+    THEN("it does not provide mutating container operations")
+    {
+      STATIC_REQUIRE(cached_hash_types::push_backable<uncached_type_alias>);
+      STATIC_REQUIRE_FALSE(cached_hash_types::push_backable<type_alias>);
+    }
+
+    THEN("it is still iterable through constant iterators")
+    {
+      auto object = type_alias{"abc"};
+      auto result = std::string{};
+      for (auto character : object)
+      {
+        result.push_back(character);
+      }
+      REQUIRE(result == "abc");
+    }
+  }
+}
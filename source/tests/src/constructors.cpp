@@ -3,7 +3,12 @@
 #include <catch2/catch_template_test_macros.hpp>
 #include <catch2/catch_test_macros.hpp>
 
+#include <map>
+#include <string>
 #include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 using fundamental_types = std::tuple<bool,
                                      char,
@@ -100,3 +105,162 @@ SCENARIO("Copy Construction", "[construction]")
     }
   }
 }
+
+SCENARIO("Copy Assignment", "[construction]")
+{
+  struct not_copy_assignable
+  {
+    not_copy_assignable() = default;
+    not_copy_assignable(not_copy_assignable const &) = default;
+    not_copy_assignable(not_copy_assignable &&) = default;
+    auto operator=(not_copy_assignable const &) -> not_copy_assignable & = delete;
+    auto operator=(not_copy_assignable &&) -> not_copy_assignable & = default;
+  };
+
+  GIVEN("A new_type over a copy-assignable type")
+  {
+    using type_alias = nt::new_type<int, struct tag>;
+    static_assert(std::is_copy_assignable_v<type_alias::base_type>);
+
+    THEN("it is copy-assignable")
+    {
+      STATIC_REQUIRE(std::is_copy_assignable_v<type_alias>);
+    }
+  }
+
+  GIVEN("A new_type over a type that is not copy-assignable")
+  {
+    using type_alias = nt::new_type<not_copy_assignable, struct tag>;
+    static_assert(!std::is_copy_assignable_v<type_alias::base_type>);
+
+    THEN("it is not copy-assignable")
+    {
+      STATIC_REQUIRE_FALSE(std::is_copy_assignable_v<type_alias>);
+    }
+
+    THEN("it is move-assignable")
+    {
+      STATIC_REQUIRE(std::is_move_assignable_v<type_alias>);
+    }
+  }
+}
+
+SCENARIO("In-place Construction", "[construction]")
+{
+  struct construction_counter
+  {
+    construction_counter(int first, int second) noexcept
+        : sum{first + second}
+    {
+    }
+
+    construction_counter(construction_counter const & other)
+        : sum{other.sum}
+        , copies{other.copies + 1}
+        , moves{other.moves}
+    {
+    }
+
+    construction_counter(construction_counter && other)
+        : sum{other.sum}
+        , copies{other.copies}
+        , moves{other.moves + 1}
+    {
+    }
+
+    int sum;
+    int copies{};
+    int moves{};
+  };
+
+  GIVEN("A new_type over a type constructible from multiple arguments")
+  {
+    using type_alias = nt::new_type<construction_counter, struct tag, deriving(nt::Indirection)>;
+
+    THEN("it is constructible in place from those arguments")
+    {
+      STATIC_REQUIRE(std::is_constructible_v<type_alias, std::in_place_t, int, int>);
+    }
+
+    THEN("in-place construction is explicit")
+    {
+      STATIC_REQUIRE_FALSE(std::is_convertible_v<std::in_place_t, type_alias>);
+    }
+
+    THEN("in-place construction is noexcept iff. the construction of the base type is noexcept")
+    {
+      STATIC_REQUIRE(std::is_nothrow_constructible_v<type_alias, std::in_place_t, int, int>);
+    }
+
+    THEN("it is not constructible in place from unrelated arguments")
+    {
+      STATIC_REQUIRE_FALSE(std::is_constructible_v<type_alias, std::in_place_t, std::string>);
+    }
+
+    THEN("in-place construction does not copy or move the base object")
+    {
+      auto obj = type_alias{std::in_place, 20, 22};
+      REQUIRE(obj->sum == 42);
+      REQUIRE(obj->copies == 0);
+      REQUIRE(obj->moves == 0);
+    }
+
+    THEN("nt::make does not copy or move the base object")
+    {
+      auto obj = nt::make<type_alias>(20, 22);
+      REQUIRE(obj->sum == 42);
+      REQUIRE(obj->copies == 0);
+      REQUIRE(obj->moves == 0);
+    }
+
+    THEN("objects can be emplaced into a std::map without copying or moving the base object")
+    {
+      auto values = std::map<int, type_alias>{};
+      values.try_emplace(1, std::in_place, 20, 22);
+      REQUIRE(values.at(1)->sum == 42);
+      REQUIRE(values.at(1)->copies == 0);
+      REQUIRE(values.at(1)->moves == 0);
+    }
+
+    THEN("objects can be emplaced into a std::unordered_map without copying or moving the base object")
+    {
+      auto values = std::unordered_map<int, type_alias>{};
+      values.try_emplace(1, std::in_place, 20, 22);
+      REQUIRE(values.at(1)->sum == 42);
+      REQUIRE(values.at(1)->copies == 0);
+      REQUIRE(values.at(1)->moves == 0);
+    }
+  }
+
+  GIVEN("A new_type over std::string")
+  {
+    using type_alias = nt::new_type<std::string, struct tag>;
+
+    THEN("it is constructible in place from a single convertible argument")
+    {
+      STATIC_REQUIRE(std::is_constructible_v<type_alias, std::in_place_t, char const *>);
+    }
+
+    THEN("in-place construction without arguments is explicit")
+    {
+      STATIC_REQUIRE_FALSE(std::is_convertible_v<std::in_place_t, type_alias>);
+    }
+
+    THEN("in-place construction from a convertible argument is noexcept iff. the conversion is noexcept")
+    {
+      STATIC_REQUIRE_FALSE(std::is_nothrow_constructible_v<type_alias, std::in_place_t, char const *>);
+    }
+
+    THEN("nt::make constructs the contained object from the arguments")
+    {
+      REQUIRE(nt::make<type_alias>(3, 'a').decay() == "aaa");
+    }
+
+    THEN("objects can be emplaced into a std::vector")
+    {
+      auto values = std::vector<type_alias>{};
+      values.emplace_back(std::in_place, "alice");
+      REQUIRE(values.front().decay() == "alice");
+    }
+  }
+}
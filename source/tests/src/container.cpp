@@ -0,0 +1,196 @@
+#include "newtype/newtype.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace container_types
+{
+
+  template<typename SubjectType>
+  concept growable = requires(SubjectType subject, typename SubjectType::base_type::value_type value) {
+    subject.push_back(value);
+    subject.emplace_back();
+    subject.reserve(0);
+    subject.resize(0);
+  };
+
+  template<typename SubjectType>
+  concept sized = requires(SubjectType const subject) {
+    subject.size();
+    subject.empty();
+  };
+
+  struct copy_counter
+  {
+    copy_counter() = default;
+
+    copy_counter(int value)
+        : value{value}
+    {
+    }
+
+    copy_counter(copy_counter const & other)
+        : value{other.value}
+        , copies{other.copies + 1}
+    {
+    }
+
+    copy_counter(copy_counter &&) = default;
+    auto operator=(copy_counter const &) -> copy_counter & = default;
+    auto operator=(copy_counter &&) -> copy_counter & = default;
+
+    int value{};
+    int copies{};
+  };
+
+}  // namespace container_types
+
+SCENARIO("Container", "[container]")
+{
+  using container_types::growable;
+  using container_types::sized;
+
+  GIVEN("A new_type over std::vector not deriving nt::Container")
+  {
+    using type_alias = nt::new_type<std::vector<int>, struct tag>;
+
+    THEN("it is not growable")
+    {
+      STATIC_REQUIRE_FALSE(growable<type_alias>);
+    }
+
+    THEN("it is not sized")
+    {
+      STATIC_REQUIRE_FALSE(sized<type_alias>);
+    }
+  }
+
+  GIVEN("A new_type over std::vector deriving nt::Container")
+  {
+    using type_alias = nt::new_type<std::vector<int>, struct tag, deriving(nt::Container)>;
+
+    THEN("it is growable")
+    {
+      STATIC_REQUIRE(growable<type_alias>);
+    }
+
+    THEN("it is sized")
+    {
+      STATIC_REQUIRE(sized<type_alias>);
+    }
+  }
+
+  GIVEN("A new_type over std::vector deriving both nt::Container and nt::Iterable")
+  {
+    using type_alias = nt::new_type<std::vector<int>, struct tag, deriving(nt::Container, nt::Iterable)>;
+
+    THEN("it is sized")
+    {
+      STATIC_REQUIRE(sized<type_alias>);
+    }
+  }
+
+  GIVEN("A new_type over std::array deriving nt::Container")
+  {
+    using type_alias = nt::new_type<std::array<int, 3>, struct tag, deriving(nt::Container)>;
+
+    THEN("it is not growable")
+    {
+      STATIC_REQUIRE_FALSE(growable<type_alias>);
+    }
+
+    THEN("it is sized")
+    {
+      STATIC_REQUIRE(sized<type_alias>);
+    }
+  }
+
+  GIVEN("An empty object of a new_type over std::vector deriving nt::Container")
+  {
+    using type_alias = nt::new_type<std::vector<std::string>, struct tag, deriving(nt::Container)>;
+    auto obj = type_alias{};
+
+    THEN("it is empty")
+    {
+      REQUIRE(obj.empty());
+      REQUIRE(obj.size() == 0);
+    }
+
+    WHEN("capacity is reserved")
+    {
+      obj.reserve(16);
+
+      THEN("the capacity is at least the reserved amount")
+      {
+        REQUIRE(obj.capacity() >= 16);
+      }
+    }
+
+    WHEN("elements are appended")
+    {
+      obj.push_back("one");
+      obj.push_back(std::string{"two"});
+      auto & emplaced = obj.emplace_back(3, '3');
+
+      THEN("the size reflects the number of appended elements")
+      {
+        REQUIRE(obj.size() == 3);
+      }
+
+      THEN("emplace_back returns a reference to the new element")
+      {
+        REQUIRE(emplaced == "333");
+      }
+
+      THEN("the elements are stored in order")
+      {
+        REQUIRE(obj.decay() == std::vector<std::string>{"one", "two", "333"});
+      }
+    }
+
+    WHEN("it is resized")
+    {
+      obj.resize(2, "x");
+
+      THEN("it contains the new elements")
+      {
+        REQUIRE(obj.decay() == std::vector<std::string>{"x", "x"});
+      }
+
+      AND_WHEN("it is cleared")
+      {
+        obj.clear();
+
+        THEN("it is empty")
+        {
+          REQUIRE(obj.empty());
+        }
+      }
+    }
+  }
+
+  GIVEN("An object of a new_type over std::vector deriving nt::Container and nt::Subscript")
+  {
+    using type_alias = nt::new_type<std::vector<container_types::copy_counter>, struct tag, deriving(nt::Container, nt::Subscript)>;
+    auto obj = type_alias{};
+
+    WHEN("elements are emplaced and modified in place")
+    {
+      obj.reserve(2);
+      obj.emplace_back(1);
+      obj.emplace_back(2);
+      obj[0].value = 42;
+
+      THEN("no element is copied")
+      {
+        REQUIRE(obj[0].copies == 0);
+        REQUIRE(obj[1].copies == 0);
+        REQUIRE(obj[0].value == 42);
+      }
+    }
+  }
+}
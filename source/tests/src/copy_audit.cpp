@@ -0,0 +1,233 @@
+#include "newtype/allocator.hpp"
+#include "newtype/newtype.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace copy_audit_types
+{
+
+  struct samples_tag;
+  using samples = nt::new_type<std::vector<int>, samples_tag>;
+
+  struct count_tag;
+  using count = nt::new_type<int, count_tag>;
+
+}  // namespace copy_audit_types
+
+#if defined(NEWTYPE_AUDIT_COPIES)
+
+namespace copy_audit_types
+{
+
+  auto violations = std::size_t{};
+
+  auto record_violation(nt::copy_audit::entry const &) -> void
+  {
+    ++violations;
+  }
+
+  auto copies_of(std::string_view type) -> std::size_t
+  {
+    auto entries = nt::copy_audit::snapshot();
+    auto found = std::ranges::find(entries, type, &nt::copy_audit::entry::type);
+    return found == entries.end() ? 0 : found->copies;
+  }
+
+}  // namespace copy_audit_types
+
+SCENARIO("Copy Audit", "[copy_audit]")
+{
+  using copy_audit_types::copies_of;
+  using copy_audit_types::count;
+  using copy_audit_types::samples;
+
+  nt::copy_audit::reset();
+
+  GIVEN("A new_type over a type that is not trivially copyable")
+  {
+    auto original = samples{std::vector<int>(100)};
+
+    WHEN("it is copy constructed")
+    {
+      auto copy = original;
+      static_cast<void>(copy);
+
+      THEN("the copy is recorded with its size")
+      {
+        auto entries = nt::copy_audit::snapshot();
+        REQUIRE(entries.size() == 1);
+        REQUIRE(entries.front().type.find("samples_tag") != std::string_view::npos);
+        REQUIRE(entries.front().copies == 1);
+        REQUIRE(entries.front().bytes == sizeof(std::vector<int>) + 100 * sizeof(int));
+      }
+    }
+
+    WHEN("it is copy assigned")
+    {
+      auto copy = samples{};
+      copy = original;
+
+      THEN("the copy is recorded")
+      {
+        REQUIRE(copies_of("copy_audit_types::samples_tag") == 1);
+      }
+    }
+
+    WHEN("it is moved")
+    {
+      auto moved = std::move(original);
+      moved = samples{};
+
+      THEN("no copy is recorded")
+      {
+        REQUIRE(nt::copy_audit::snapshot().empty());
+      }
+    }
+
+    WHEN("copies are made at different call sites")
+    {
+      auto first = original;
+      auto second = original;
+      auto copies = std::vector<samples>(3, first);
+      static_cast<void>(second);
+
+      THEN("the report ranks them by the number of bytes copied")
+      {
+        auto entries = nt::copy_audit::snapshot();
+        REQUIRE(entries.size() >= 2);
+        REQUIRE(std::ranges::is_sorted(entries, std::ranges::greater{}, &nt::copy_audit::entry::bytes));
+
+        auto report = std::ostringstream{};
+        nt::copy_audit::report(report);
+        REQUIRE(report.str().find("samples_tag") != std::string::npos);
+      }
+    }
+  }
+
+  GIVEN("A new_type over a trivially copyable type")
+  {
+    auto original = count{42};
+
+    WHEN("it is copied")
+    {
+      auto copy = original;
+      static_cast<void>(copy);
+
+      THEN("no copy is recorded")
+      {
+        REQUIRE(nt::copy_audit::snapshot().empty());
+      }
+    }
+  }
+
+  GIVEN("A no_copies_scope and a custom violation handler")
+  {
+    copy_audit_types::violations = 0;
+    auto previous = nt::copy_audit::set_violation_handler(copy_audit_types::record_violation);
+    auto original = samples{std::vector<int>(10)};
+
+    WHEN("an object is copied inside the scope")
+    {
+      {
+        auto guard = nt::no_copies_scope{};
+        auto copy = original;
+        static_cast<void>(copy);
+      }
+
+      THEN("the violation handler is invoked")
+      {
+        REQUIRE(copy_audit_types::violations == 1);
+      }
+    }
+
+    WHEN("an object is decayed inside the scope")
+    {
+      {
+        auto guard = nt::no_copies_scope{};
+        auto copy = original.decay();
+        static_cast<void>(copy);
+      }
+
+      THEN("the violation handler is invoked")
+      {
+        REQUIRE(copy_audit_types::violations == 1);
+      }
+    }
+
+    WHEN("an object is copied using an allocator inside the scope")
+    {
+      {
+        auto guard = nt::no_copies_scope{};
+        auto copy = samples{std::allocator_arg, std::allocator<int>{}, original};
+        static_cast<void>(copy);
+      }
+
+      THEN("the violation handler is invoked")
+      {
+        REQUIRE(copy_audit_types::violations == 1);
+      }
+    }
+
+    WHEN("an object is moved inside the scope and copied after it")
+    {
+      {
+        auto guard = nt::no_copies_scope{};
+        auto moved = std::move(original);
+        original = std::move(moved);
+      }
+      auto copy = original;
+      static_cast<void>(copy);
+
+      THEN("the violation handler is not invoked")
+      {
+        REQUIRE(copy_audit_types::violations == 0);
+      }
+    }
+
+    nt::copy_audit::set_violation_handler(previous);
+  }
+
+  nt::copy_audit::reset();
+}
+
+#else
+
+SCENARIO("Copy Audit", "[copy_audit]")
+{
+  GIVEN("A build without copy auditing")
+  {
+    THEN("new_types over types that are not trivially copyable keep their size")
+    {
+      STATIC_REQUIRE(sizeof(copy_audit_types::samples) == sizeof(std::vector<int>));
+    }
+
+    THEN("new_types over trivially copyable types remain trivially copyable")
+    {
+      STATIC_REQUIRE(std::is_trivially_copyable_v<copy_audit_types::count>);
+    }
+
+    THEN("a no_copies_scope is empty")
+    {
+      STATIC_REQUIRE(std::is_empty_v<nt::no_copies_scope>);
+    }
+
+    THEN("copies inside a no_copies_scope are permitted")
+    {
+      auto original = copy_audit_types::samples{std::vector<int>(10)};
+      auto guard = nt::no_copies_scope{};
+      auto copy = original;
+      REQUIRE(copy == original);
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,133 @@
+#include "newtype/default_init_allocator.hpp"
+#include "newtype/newtype.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+SCENARIO("Default Initialization", "[construction]")
+{
+  GIVEN("A new_type over a trivially default-constructible type not deriving nt::DefaultInit")
+  {
+    using type_alias = nt::new_type<double, struct tag>;
+    static_assert(std::is_trivially_default_constructible_v<type_alias::base_type>);
+
+    THEN("it is not trivially default-constructible")
+    {
+      STATIC_REQUIRE_FALSE(std::is_trivially_default_constructible_v<type_alias>);
+    }
+
+    THEN("default construction value-initializes the contained object")
+    {
+      STATIC_REQUIRE(type_alias{}.decay() == 0.0);
+    }
+  }
+
+  GIVEN("A new_type over a trivially default-constructible type deriving nt::DefaultInit")
+  {
+    using type_alias = nt::new_type<double, struct tag, deriving(nt::DefaultInit)>;
+
+    THEN("it is trivially default-constructible")
+    {
+      STATIC_REQUIRE(std::is_trivially_default_constructible_v<type_alias>);
+    }
+
+    THEN("it is trivially copyable")
+    {
+      STATIC_REQUIRE(std::is_trivially_copyable_v<type_alias>);
+    }
+
+    THEN("it is nothrow default-constructible")
+    {
+      STATIC_REQUIRE(std::is_nothrow_default_constructible_v<type_alias>);
+    }
+
+    THEN("value initialization still zeroes the contained object")
+    {
+      REQUIRE(type_alias{}.decay() == 0.0);
+    }
+  }
+
+  GIVEN("A new_type over a non-trivially default-constructible type deriving nt::DefaultInit")
+  {
+    using type_alias = nt::new_type<std::string, struct tag, deriving(nt::DefaultInit)>;
+
+    THEN("default construction default-constructs the contained object")
+    {
+      auto obj = type_alias{};
+      REQUIRE(obj.decay().empty());
+    }
+  }
+
+  GIVEN("A new_type over a type that is not default-constructible deriving nt::DefaultInit")
+  {
+    struct not_default_constructible
+    {
+      not_default_constructible() = delete;
+    };
+    using type_alias = nt::new_type<not_default_constructible, struct tag, deriving(nt::DefaultInit)>;
+
+    THEN("it is not default-constructible")
+    {
+      STATIC_REQUIRE_FALSE(std::is_default_constructible_v<type_alias>);
+    }
+  }
+}
+
+SCENARIO("Default Initializing Allocator", "[construction]")
+{
+  using value_type = nt::new_type<double, struct tag, deriving(nt::DefaultInit)>;
+  using allocator_type = nt::default_init_allocator<value_type>;
+
+  GIVEN("A default_init_allocator")
+  {
+    THEN("it satisfies the allocator requirements of std::vector")
+    {
+      STATIC_REQUIRE(std::is_same_v<typename std::allocator_traits<allocator_type>::value_type, value_type>);
+      STATIC_REQUIRE(std::is_same_v<typename std::allocator_traits<allocator_type>::template rebind_alloc<int>,
+                                    nt::default_init_allocator<int>>);
+    }
+
+    THEN("it compares equal to another default_init_allocator")
+    {
+      REQUIRE(allocator_type{} == allocator_type{});
+    }
+  }
+
+  GIVEN("A std::vector using a default_init_allocator")
+  {
+    auto values = std::vector<value_type, allocator_type>(16);
+
+    THEN("it has the requested size")
+    {
+      REQUIRE(values.size() == 16);
+    }
+
+    WHEN("elements are constructed from arguments")
+    {
+      values.assign(4, value_type{2.5});
+      values.emplace_back(1.5);
+
+      THEN("the arguments are forwarded to the constructor")
+      {
+        REQUIRE(values.size() == 5);
+        REQUIRE(values.front().decay() == 2.5);
+        REQUIRE(values.back().decay() == 1.5);
+      }
+    }
+
+    WHEN("it is resized")
+    {
+      values.resize(4);
+      values.resize(64);
+
+      THEN("it has the new size")
+      {
+        REQUIRE(values.size() == 64);
+      }
+    }
+  }
+}
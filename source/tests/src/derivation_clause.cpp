@@ -2,7 +2,23 @@
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <bit>
+#include <set>
 #include <string>
+#include <type_traits>
+#include <typeindex>
+#include <typeinfo>
+
+namespace derivation_clause_types
+{
+
+  auto constexpr Audited = nt::derivable<struct audited_tag>{};
+  auto constexpr Logged = nt::derivable<struct logged_tag>{};
+
+  template<auto DerivationClause>
+  using strong_int = nt::new_type<int, struct strong_int_tag, DerivationClause>;
+
+}  // namespace derivation_clause_types
 
 SCENARIO("Derivation Clause", "[infrastructure]")
 {
@@ -60,4 +76,122 @@ SCENARIO("Derivation Clause", "[infrastructure]")
       STATIC_REQUIRE_FALSE(nt::derives<decltype(clause), nt::Arithmetic, nt::Show>);
     }
   }
+
+  GIVEN("Derivation clauses listing the same derivables in different orders")
+  {
+    auto show_hash = deriving(nt::Show, nt::Hash);
+    auto hash_show = deriving(nt::Hash, nt::Show);
+
+    THEN("they are of the same type")
+    {
+      STATIC_REQUIRE(std::is_same_v<decltype(show_hash), decltype(hash_show)>);
+    }
+
+    THEN("new_types using them are of the same type")
+    {
+      using derivation_clause_types::strong_int;
+      STATIC_REQUIRE(std::is_same_v<strong_int<deriving(nt::Show, nt::Hash)>, strong_int<deriving(nt::Hash, nt::Show)>>);
+    }
+
+    THEN("they list the derivables in the order of their indices")
+    {
+      using show_tag = decltype(nt::Show)::tag_type;
+      using hash_tag = decltype(nt::Hash)::tag_type;
+      STATIC_REQUIRE(std::is_same_v<decltype(show_hash), nt::derivation_clause<hash_tag, show_tag>>);
+    }
+  }
+
+  GIVEN("Derivation clauses listing the same user-defined derivables in different orders")
+  {
+    using derivation_clause_types::Audited;
+    using derivation_clause_types::Logged;
+    using derivation_clause_types::strong_int;
+
+    THEN("new_types using them are of the same type")
+    {
+      STATIC_REQUIRE(std::is_same_v<strong_int<deriving(Audited, Logged)>, strong_int<deriving(Logged, Audited)>>);
+    }
+
+    THEN("new_types also using standard derivables are of the same type")
+    {
+      STATIC_REQUIRE(
+          std::is_same_v<strong_int<deriving(Logged, nt::Show, Audited)>, strong_int<deriving(Audited, Logged, nt::Show, Logged)>>);
+    }
+  }
+
+  GIVEN("A derivation clause listing a derivable more than once")
+  {
+    auto clause = deriving(nt::Show, nt::Relational, nt::Show);
+
+    THEN("it is of the same type as the one listing it once")
+    {
+      STATIC_REQUIRE(std::is_same_v<decltype(clause), decltype(deriving(nt::Relational, nt::Show))>);
+    }
+
+    THEN("it still contains the derivable")
+    {
+      STATIC_REQUIRE(nt::derives<decltype(clause), nt::Show, nt::Relational>);
+    }
+  }
+
+  GIVEN("All permutations of a set of derivables")
+  {
+    using derivation_clause_types::strong_int;
+
+    auto instantiations = std::set<std::type_index>{
+        typeid(strong_int<deriving(nt::Show, nt::Hash, nt::Arithmetic)>),
+        typeid(strong_int<deriving(nt::Show, nt::Arithmetic, nt::Hash)>),
+        typeid(strong_int<deriving(nt::Hash, nt::Show, nt::Arithmetic)>),
+        typeid(strong_int<deriving(nt::Hash, nt::Arithmetic, nt::Show)>),
+        typeid(strong_int<deriving(nt::Arithmetic, nt::Show, nt::Hash)>),
+        typeid(strong_int<deriving(nt::Arithmetic, nt::Hash, nt::Show, nt::Hash)>),
+    };
+
+    THEN("they instantiate a single new_type")
+    {
+      REQUIRE(instantiations.size() == 1);
+    }
+  }
+
+  GIVEN("A derivation clause containing standard derivables")
+  {
+    auto clause = deriving(nt::Show, nt::Hash);
+
+    THEN("its feature mask has one bit per derivable")
+    {
+      STATIC_REQUIRE(std::popcount(decltype(clause)::features) == 2);
+    }
+
+    THEN("its feature mask is independent of the order of the derivables")
+    {
+      using show_tag = decltype(nt::Show)::tag_type;
+      using hash_tag = decltype(nt::Hash)::tag_type;
+      STATIC_REQUIRE(nt::derivation_clause<show_tag, hash_tag>::features == nt::derivation_clause<hash_tag, show_tag>::features);
+    }
+  }
+
+  GIVEN("A derivation clause containing user-defined derivables")
+  {
+    using derivation_clause_types::Audited;
+    using derivation_clause_types::Logged;
+
+    auto clause = deriving(Audited, nt::Show);
+
+    THEN("it contains the user-defined derivable")
+    {
+      STATIC_REQUIRE(nt::derives<decltype(clause), Audited>);
+      STATIC_REQUIRE(nt::derives<decltype(clause), Audited, nt::Show>);
+    }
+
+    THEN("it does not contain other user-defined derivables")
+    {
+      STATIC_REQUIRE_FALSE(nt::derives<decltype(clause), Logged>);
+      STATIC_REQUIRE_FALSE(nt::derives<decltype(clause), Audited, Logged>);
+    }
+
+    THEN("user-defined derivables do not occupy a bit of its feature mask")
+    {
+      STATIC_REQUIRE(decltype(clause)::features == decltype(deriving(nt::Show))::features);
+    }
+  }
 }
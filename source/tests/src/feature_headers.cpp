@@ -0,0 +1,81 @@
+#include "newtype/core.hpp"
+#include "newtype/hash.hpp"
+#include "newtype/iterable.hpp"
+#include "newtype/read.hpp"
+#include "newtype/show.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <functional>
+#include <ranges>
+#include <sstream>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+namespace feature_headers_types
+{
+
+  using counter = nt::new_type<int, struct counter_tag, deriving(nt::Relational)>;
+  using label = nt::new_type<int, struct label_tag, deriving(nt::Show, nt::Read, nt::Hash)>;
+  using samples = nt::new_type<std::vector<int>, struct samples_tag, deriving(nt::Iterable)>;
+  using text = nt::new_type<std::string_view, struct text_tag, deriving(nt::Iterable)>;
+
+}  // namespace feature_headers_types
+
+SCENARIO("Feature Headers", "[headers]")
+{
+  GIVEN("A new_type deriving nt::Relational")
+  {
+    using type_alias = feature_headers_types::counter;
+
+    THEN("<newtype/core.hpp> provides its operators")
+    {
+      STATIC_REQUIRE(type_alias{1} < type_alias{2});
+      STATIC_REQUIRE(type_alias{2} >= type_alias{2});
+    }
+  }
+
+  GIVEN("A new_type deriving nt::Show, nt::Read, and nt::Hash")
+  {
+    using type_alias = feature_headers_types::label;
+
+    THEN("<newtype/show.hpp> provides its output operator")
+    {
+      auto stream = std::ostringstream{};
+      stream << type_alias{42};
+      REQUIRE(stream.str() == "42");
+    }
+
+    THEN("<newtype/read.hpp> provides its input operator")
+    {
+      auto stream = std::istringstream{"17"};
+      auto object = type_alias{};
+      stream >> object;
+      REQUIRE(object.decay() == 17);
+    }
+
+    THEN("<newtype/hash.hpp> provides its std::hash specialization")
+    {
+      auto set = std::unordered_set<type_alias>{type_alias{1}, type_alias{1}, type_alias{2}};
+      REQUIRE(set.size() == 2);
+      REQUIRE(std::hash<type_alias>{}(type_alias{3}) == std::hash<int>{}(3));
+    }
+  }
+
+  GIVEN("A new_type deriving nt::Iterable")
+  {
+    THEN("<newtype/iterable.hpp> provides its free iterator accessors")
+    {
+      auto object = feature_headers_types::samples{std::vector{1, 2, 3}};
+      REQUIRE(*begin(object) == 1);
+      REQUIRE(end(object) - begin(object) == 3);
+    }
+
+    THEN("<newtype/iterable.hpp> propagates borrowed ranges")
+    {
+      STATIC_REQUIRE(std::ranges::borrowed_range<feature_headers_types::text>);
+      STATIC_REQUIRE_FALSE(std::ranges::borrowed_range<feature_headers_types::samples>);
+    }
+  }
+}
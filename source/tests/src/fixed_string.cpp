@@ -0,0 +1,181 @@
+#include "newtype/fixed_string.hpp"
+#include "newtype/newtype.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_set>
+#include <vector>
+
+namespace fixed_string_types
+{
+
+  using ticker = nt::new_type<nt::fixed_string<7>,
+                              struct ticker_tag,
+                              deriving(nt::Show, nt::Read, nt::Hash, nt::Relational, nt::EqBase)>;
+
+}  // namespace fixed_string_types
+
+SCENARIO("Fixed Strings", "[fixed_string]")
+{
+  GIVEN("A fixed string type")
+  {
+    using type_alias = nt::fixed_string<7>;
+
+    THEN("it is trivially copyable")
+    {
+      STATIC_REQUIRE(std::is_trivially_copyable_v<type_alias>);
+    }
+
+    THEN("its size and contents fit into a single machine word")
+    {
+      STATIC_REQUIRE(sizeof(type_alias) == 8);
+    }
+
+    THEN("it is constructible from a string literal at compile time")
+    {
+      STATIC_REQUIRE(type_alias{"AAPL"}.view() == "AAPL");
+      STATIC_REQUIRE(type_alias{"AAPL"}.size() == 4);
+    }
+
+    THEN("it is not implicitly convertible from a string literal that exceeds its capacity")
+    {
+      STATIC_REQUIRE_FALSE(std::is_convertible_v<char const (&)[9], type_alias>);
+    }
+
+    THEN("it is not implicitly constructible from a std::string_view")
+    {
+      STATIC_REQUIRE_FALSE(std::is_convertible_v<std::string_view, type_alias>);
+    }
+
+    THEN("it deduces its capacity from a string literal")
+    {
+      STATIC_REQUIRE(std::is_same_v<decltype(nt::fixed_string{"ABC"}), nt::fixed_string<3>>);
+    }
+  }
+
+  GIVEN("A std::string_view that exceeds the capacity of a fixed string type")
+  {
+    auto value = std::string_view{"TOO LONG"};
+
+    THEN("constructing a fixed string from it throws std::length_error")
+    {
+      REQUIRE_THROWS_AS(nt::fixed_string<7>{value}, std::length_error);
+    }
+  }
+
+  GIVEN("Two fixed strings")
+  {
+    auto constexpr lhs = nt::fixed_string<7>{"AAPL"};
+    auto constexpr rhs = nt::fixed_string<7>{"MSFT"};
+
+    THEN("they compare by their contents")
+    {
+      STATIC_REQUIRE(lhs == nt::fixed_string<7>{std::string_view{"AAPL"}});
+      STATIC_REQUIRE(lhs != rhs);
+      STATIC_REQUIRE(lhs < rhs);
+      STATIC_REQUIRE(nt::fixed_string<7>{"AA"} < lhs);
+    }
+
+    THEN("their hash is the hash of their contents")
+    {
+      REQUIRE(std::hash<nt::fixed_string<7>>{}(lhs) == std::hash<std::string_view>{}("AAPL"));
+    }
+  }
+}
+
+SCENARIO("Fixed String New Types", "[fixed_string]")
+{
+  using fixed_string_types::ticker;
+
+  GIVEN("A new_type over a fixed string")
+  {
+    THEN("it is trivially copyable")
+    {
+      STATIC_REQUIRE(std::is_trivially_copyable_v<ticker>);
+    }
+
+    THEN("it is constructible from a string literal")
+    {
+      auto value = ticker{"AAPL"};
+      REQUIRE(value == nt::fixed_string<7>{"AAPL"});
+    }
+  }
+
+  GIVEN("An object of a new_type over a fixed string deriving nt::Show")
+  {
+    auto value = ticker{"AAPL"};
+
+    THEN("it can be written to an output stream")
+    {
+      auto output = std::ostringstream{};
+      output << value;
+      REQUIRE(output.str() == "AAPL");
+    }
+  }
+
+  GIVEN("An input stream containing values of a new_type over a fixed string deriving nt::Read")
+  {
+    auto input = std::istringstream{"AAPL MSFT"};
+
+    THEN("the values can be read")
+    {
+      auto first = ticker{};
+      auto second = ticker{};
+      input >> first >> second;
+
+      REQUIRE(first == ticker{"AAPL"});
+      REQUIRE(second == ticker{"MSFT"});
+    }
+  }
+
+  GIVEN("An input stream containing a value exceeding the capacity of the fixed string")
+  {
+    auto input = std::istringstream{"TOOLONGVALUE"};
+
+    THEN("reading the value fails")
+    {
+      auto value = ticker{};
+      input >> value;
+
+      REQUIRE(input.fail());
+      REQUIRE(value == ticker{});
+    }
+  }
+
+  GIVEN("A set of objects of a new_type over a fixed string")
+  {
+    auto values = std::vector<ticker>{ticker{"MSFT"}, ticker{"AAPL"}, ticker{"GOOG"}, ticker{"AAPL"}};
+
+    THEN("they can be sorted")
+    {
+      std::ranges::sort(values);
+      REQUIRE(values == std::vector<ticker>{ticker{"AAPL"}, ticker{"AAPL"}, ticker{"GOOG"}, ticker{"MSFT"}});
+    }
+
+    THEN("they can be used as keys in an ordered container")
+    {
+      auto map = std::map<ticker, int>{};
+      for (auto const & value : values)
+      {
+        ++map[value];
+      }
+      REQUIRE(map.size() == 3);
+      REQUIRE(map.at(ticker{"AAPL"}) == 2);
+    }
+
+    THEN("they can be used as keys in an unordered container")
+    {
+      auto set = std::unordered_set<ticker>{values.begin(), values.end()};
+      REQUIRE(set.size() == 3);
+      REQUIRE(set.contains(ticker{"GOOG"}));
+    }
+  }
+}
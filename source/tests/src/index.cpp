@@ -0,0 +1,194 @@
+#include "newtype/newtype.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace index_types
+{
+
+  template<typename SubjectType>
+  concept has_difference_type = requires { typename SubjectType::difference_type; };
+
+}  // namespace index_types
+
+SCENARIO("Increment and Decrement", "[index]")
+{
+  GIVEN("A new_type not deriving nt::Index")
+  {
+    using type_alias = nt::new_type<int, struct tag>;
+
+    THEN("it is not incrementable")
+    {
+      STATIC_REQUIRE_FALSE(nt::concepts::incrementable<type_alias>);
+    }
+
+    THEN("it is not decrementable")
+    {
+      STATIC_REQUIRE_FALSE(nt::concepts::decrementable<type_alias>);
+    }
+  }
+
+  GIVEN("A new_type over an incrementable and decrementable type deriving nt::Index")
+  {
+    using type_alias = nt::new_type<std::size_t, struct tag, deriving(nt::Index)>;
+
+    THEN("it is incrementable")
+    {
+      STATIC_REQUIRE(nt::concepts::incrementable<type_alias>);
+    }
+
+    THEN("it is decrementable")
+    {
+      STATIC_REQUIRE(nt::concepts::decrementable<type_alias>);
+    }
+
+    THEN("pre-increment returns a reference to the same type")
+    {
+      STATIC_REQUIRE(std::is_same_v<type_alias &, decltype(++std::declval<type_alias &>())>);
+    }
+
+    THEN("post-increment returns the same type")
+    {
+      STATIC_REQUIRE(std::is_same_v<type_alias, decltype(std::declval<type_alias &>()++)>);
+    }
+
+    THEN("incrementing is noexcept")
+    {
+      STATIC_REQUIRE(noexcept(++std::declval<type_alias &>()));
+    }
+  }
+
+  GIVEN("A new_type over a non-incrementable type deriving nt::Index")
+  {
+    struct not_incrementable
+    {
+    };
+    using type_alias = nt::new_type<not_incrementable, struct tag, deriving(nt::Index)>;
+
+    THEN("it is not incrementable")
+    {
+      STATIC_REQUIRE_FALSE(nt::concepts::incrementable<type_alias>);
+    }
+  }
+
+  GIVEN("An object of a new_type deriving nt::Index")
+  {
+    using type_alias = nt::new_type<int, struct tag, deriving(nt::Index)>;
+    auto index = type_alias{41};
+
+    THEN("pre-increment yields the incremented value")
+    {
+      REQUIRE((++index).decay() == 42);
+      REQUIRE(index.decay() == 42);
+    }
+
+    THEN("post-increment yields the previous value")
+    {
+      REQUIRE((index++).decay() == 41);
+      REQUIRE(index.decay() == 42);
+    }
+
+    THEN("pre-decrement yields the decremented value")
+    {
+      REQUIRE((--index).decay() == 40);
+      REQUIRE(index.decay() == 40);
+    }
+
+    THEN("post-decrement yields the previous value")
+    {
+      REQUIRE((index--).decay() == 41);
+      REQUIRE(index.decay() == 40);
+    }
+  }
+}
+
+SCENARIO("Index Differences", "[index]")
+{
+  GIVEN("A new_type not deriving nt::Index")
+  {
+    using type_alias = nt::new_type<std::size_t, struct tag>;
+
+    THEN("it has no difference type")
+    {
+      STATIC_REQUIRE_FALSE(index_types::has_difference_type<type_alias>);
+    }
+  }
+
+  GIVEN("A new_type over an unsigned integral type deriving nt::Index")
+  {
+    using type_alias = nt::new_type<std::size_t, struct tag, deriving(nt::Index)>;
+
+    THEN("its difference type is the difference type of the base type")
+    {
+      STATIC_REQUIRE(std::is_same_v<typename type_alias::difference_type, std::iter_difference_t<std::size_t>>);
+    }
+
+    THEN("the difference between two objects is of the difference type")
+    {
+      STATIC_REQUIRE(std::is_same_v<typename type_alias::difference_type,
+                                    decltype(std::declval<type_alias const &>() - std::declval<type_alias const &>())>);
+    }
+
+    THEN("it is a weakly incrementable type")
+    {
+      STATIC_REQUIRE(std::weakly_incrementable<type_alias>);
+    }
+
+    THEN("it is an incrementable type")
+    {
+      STATIC_REQUIRE(std::incrementable<type_alias>);
+    }
+  }
+
+  GIVEN("A new_type over a floating point type deriving nt::Index")
+  {
+    using type_alias = nt::new_type<double, struct tag, deriving(nt::Index)>;
+
+    THEN("it has no difference type")
+    {
+      STATIC_REQUIRE_FALSE(index_types::has_difference_type<type_alias>);
+    }
+  }
+
+  GIVEN("Two objects of a new_type deriving nt::Index")
+  {
+    using type_alias = nt::new_type<std::size_t, struct tag, deriving(nt::Index)>;
+    auto lhs = type_alias{3};
+    auto rhs = type_alias{7};
+
+    THEN("their difference is signed")
+    {
+      REQUIRE(lhs - rhs == -4);
+      REQUIRE(rhs - lhs == 4);
+    }
+
+    THEN("they can be offset by their difference")
+    {
+      REQUIRE(lhs + (rhs - lhs) == rhs);
+      REQUIRE((rhs - lhs) + lhs == rhs);
+      REQUIRE(rhs - (rhs - lhs) == lhs);
+    }
+
+    THEN("compound offsetting modifies the object")
+    {
+      lhs += 4;
+      REQUIRE(lhs == rhs);
+      lhs -= 4;
+      REQUIRE(lhs.decay() == 3);
+    }
+  }
+
+  GIVEN("A new_type deriving both nt::Index and nt::Arithmetic")
+  {
+    using type_alias = nt::new_type<int, struct tag, deriving(nt::Index, nt::Arithmetic)>;
+
+    THEN("subtraction produces the same type")
+    {
+      STATIC_REQUIRE(std::is_same_v<type_alias, decltype(std::declval<type_alias const &>() - std::declval<type_alias const &>())>);
+    }
+  }
+}
@@ -0,0 +1,127 @@
+#include "newtype/indexed_vector.hpp"
+#include "newtype/newtype.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstddef>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+namespace indexed_vector_types
+{
+
+  using row = nt::new_type<std::size_t, struct row_tag, deriving(nt::Index, nt::Relational)>;
+  using column = nt::new_type<std::size_t, struct column_tag, deriving(nt::Index, nt::Relational)>;
+
+  template<typename ContainerType, typename IndexType>
+  concept subscriptable_with = requires(ContainerType container, IndexType index) { container[index]; };
+
+}  // namespace indexed_vector_types
+
+SCENARIO("Index Ranges", "[index]")
+{
+  using indexed_vector_types::row;
+
+  GIVEN("Two objects of a new_type deriving nt::Index and nt::Relational")
+  {
+    auto first = row{2};
+    auto last = row{6};
+
+    THEN("nt::indices produces a sized random access range")
+    {
+      using range_type = decltype(nt::indices(first, last));
+      STATIC_REQUIRE(std::ranges::random_access_range<range_type>);
+      STATIC_REQUIRE(std::ranges::sized_range<range_type>);
+    }
+
+    THEN("nt::indices visits every index in the half-open interval")
+    {
+      auto expected = std::size_t{2};
+      for (auto index : nt::indices(first, last))
+      {
+        REQUIRE(index.decay() == expected++);
+      }
+      REQUIRE(expected == 6);
+    }
+  }
+}
+
+SCENARIO("Indexed Vector", "[index]")
+{
+  using indexed_vector_types::column;
+  using indexed_vector_types::row;
+  using indexed_vector_types::subscriptable_with;
+
+  GIVEN("An indexed_vector indexed by a strong index")
+  {
+    using vector_type = nt::indexed_vector<row, std::string>;
+
+    THEN("it is subscriptable with its index type")
+    {
+      STATIC_REQUIRE(subscriptable_with<vector_type, row>);
+      STATIC_REQUIRE(subscriptable_with<vector_type const, row>);
+    }
+
+    THEN("it is not subscriptable with the base type of its index type")
+    {
+      STATIC_REQUIRE_FALSE(subscriptable_with<vector_type, std::size_t>);
+      STATIC_REQUIRE_FALSE(subscriptable_with<vector_type const, std::size_t>);
+    }
+
+    THEN("it is not subscriptable with a different index type")
+    {
+      STATIC_REQUIRE_FALSE(subscriptable_with<vector_type, column>);
+    }
+
+    THEN("it has the same size as a std::vector")
+    {
+      STATIC_REQUIRE(sizeof(vector_type) == sizeof(std::vector<std::string>));
+    }
+  }
+
+  GIVEN("An indexed_vector containing some values")
+  {
+    auto values = nt::indexed_vector<row, int>{1, 2, 3, 4};
+
+    THEN("subscripting yields the element at the index")
+    {
+      REQUIRE(values[row{0}] == 1);
+      REQUIRE(values[row{3}] == 4);
+    }
+
+    THEN("subscripting yields a modifiable reference")
+    {
+      values[row{1}] = 42;
+      REQUIRE(values[row{1}] == 42);
+    }
+
+    THEN("checked access throws for out of range indices")
+    {
+      REQUIRE_THROWS_AS(values.at(row{4}), std::out_of_range);
+    }
+
+    THEN("its indices cover all elements")
+    {
+      auto sum = 0;
+      for (auto index : values.indices())
+      {
+        sum += values[index];
+      }
+      REQUIRE(sum == 10);
+      REQUIRE(std::ranges::size(values.indices()) == values.size());
+    }
+
+    WHEN("an element is appended")
+    {
+      values.push_back(5);
+
+      THEN("it is accessible at the last index")
+      {
+        REQUIRE(values.size() == 5);
+        REQUIRE(values[row{4}] == 5);
+      }
+    }
+  }
+}
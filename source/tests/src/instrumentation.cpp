@@ -0,0 +1,176 @@
+#include "newtype/instrumented.hpp"
+#include "newtype/newtype.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <functional>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace instrumentation_types
+{
+
+  struct meters_tag;
+  using meters = nt::new_type<int, meters_tag, deriving(nt::Arithmetic, nt::Relational, nt::Hash, nt::Instrumented)>;
+
+  struct name_tag;
+  using name = nt::new_type<std::string, name_tag, deriving(nt::Instrumented)>;
+
+  struct position_tag;
+  using position = nt::new_type<int, position_tag, deriving(nt::Index, nt::Instrumented)>;
+
+  struct plain_tag;
+  using plain = nt::new_type<int, plain_tag, deriving(nt::Arithmetic, nt::Relational, nt::Hash)>;
+
+}  // namespace instrumentation_types
+
+SCENARIO("Instrumentation", "[instrumentation]")
+{
+  using instrumentation_types::meters;
+  using instrumentation_types::meters_tag;
+  using instrumentation_types::name;
+  using instrumentation_types::name_tag;
+
+  GIVEN("A new_type not deriving nt::Instrumented")
+  {
+    using type_alias = instrumentation_types::plain;
+
+    THEN("it has the same size as its base type")
+    {
+      STATIC_REQUIRE(sizeof(type_alias) == sizeof(int));
+    }
+
+    THEN("it is still trivially copyable")
+    {
+      STATIC_REQUIRE(std::is_trivially_copyable_v<type_alias>);
+    }
+
+    THEN("its operations are not counted")
+    {
+      nt::instrumentation::reset<instrumentation_types::plain_tag>();
+      auto value = type_alias{1} + type_alias{2};
+      static_cast<void>(value < type_alias{4});
+      REQUIRE(nt::instrumentation::snapshot<instrumentation_types::plain_tag>() == nt::instrumentation::counters{});
+    }
+  }
+
+  GIVEN("A new_type deriving nt::Instrumented")
+  {
+    nt::instrumentation::reset<meters_tag>();
+
+    THEN("it has the same size as its base type")
+    {
+      STATIC_REQUIRE(sizeof(meters) == sizeof(int));
+    }
+
+    THEN("it is usable in constant expressions")
+    {
+      STATIC_REQUIRE((meters{1} + meters{2}).decay() == 3);
+    }
+
+    WHEN("objects are constructed")
+    {
+      auto first = meters{1};
+      auto second = meters{};
+
+      THEN("the constructions are counted")
+      {
+        REQUIRE(nt::instrumentation::snapshot<meters_tag>().constructions == 2);
+        static_cast<void>(first);
+        static_cast<void>(second);
+      }
+    }
+
+    WHEN("objects are copied and moved")
+    {
+      auto original = meters{1};
+      auto copy = original;
+      auto moved = std::move(original);
+      copy = moved;
+      moved = std::move(copy);
+
+      THEN("each special member function is counted")
+      {
+        auto counters = nt::instrumentation::snapshot<meters_tag>();
+        REQUIRE(counters.constructions == 1);
+        REQUIRE(counters.copies == 1);
+        REQUIRE(counters.moves == 1);
+        REQUIRE(counters.copy_assignments == 1);
+        REQUIRE(counters.move_assignments == 1);
+      }
+    }
+
+    WHEN("arithmetic operators, comparison operators, and the hash are used")
+    {
+      auto lhs = meters{1};
+      auto rhs = meters{2};
+      lhs += rhs;
+      static_cast<void>(lhs * rhs);
+      static_cast<void>(lhs < rhs);
+      static_cast<void>(lhs == rhs);
+      static_cast<void>(lhs >= rhs);
+      static_cast<void>(std::hash<meters>{}(lhs));
+
+      THEN("each operation is counted")
+      {
+        auto counters = nt::instrumentation::snapshot<meters_tag>();
+        REQUIRE(counters.arithmetic == 2);
+        REQUIRE(counters.comparisons == 3);
+        REQUIRE(counters.hashes == 1);
+      }
+    }
+
+    WHEN("the counters are reset")
+    {
+      static_cast<void>(meters{1} + meters{2});
+      nt::instrumentation::reset<meters_tag>();
+
+      THEN("all counters are zero")
+      {
+        REQUIRE(nt::instrumentation::snapshot<meters_tag>() == nt::instrumentation::counters{});
+      }
+    }
+  }
+
+  GIVEN("A new_type deriving nt::Index and nt::Instrumented")
+  {
+    using instrumentation_types::position;
+    using instrumentation_types::position_tag;
+
+    nt::instrumentation::reset<position_tag>();
+
+    WHEN("it is incremented and decremented")
+    {
+      auto index = position{1};
+      ++index;
+      --index;
+      index++;
+      index--;
+
+      THEN("each increment and decrement is counted as an arithmetic operation")
+      {
+        REQUIRE(nt::instrumentation::snapshot<position_tag>().arithmetic == 4);
+      }
+    }
+  }
+
+  GIVEN("Two different new_types deriving nt::Instrumented")
+  {
+    nt::instrumentation::reset<meters_tag>();
+    nt::instrumentation::reset<name_tag>();
+
+    WHEN("objects of one of them are copied")
+    {
+      auto names = std::vector<name>{name{"Alice"}, name{"Bob"}};
+      auto copies = names;
+
+      THEN("only the counters of that type change")
+      {
+        REQUIRE(nt::instrumentation::snapshot<name_tag>().copies >= 4);
+        REQUIRE(nt::instrumentation::snapshot<meters_tag>() == nt::instrumentation::counters{});
+      }
+    }
+  }
+}
@@ -0,0 +1,215 @@
+#include "newtype/interned.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <compare>
+#include <cstddef>
+#include <functional>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <unordered_set>
+#include <vector>
+
+namespace interned_types
+{
+
+  using symbol = nt::interned<struct symbol_tag>;
+  using keyword = nt::interned<struct keyword_tag>;
+  using local_symbol = nt::interned<struct local_symbol_tag, false>;
+
+  template<typename StreamType, typename SubjectType>
+  concept streamable_to = requires(StreamType & stream, SubjectType const & subject) { stream << subject; };
+
+}  // namespace interned_types
+
+SCENARIO("Interned Strings", "[interned]")
+{
+  using interned_types::symbol;
+
+  GIVEN("An interned string type")
+  {
+    THEN("it is trivially copyable")
+    {
+      STATIC_REQUIRE(std::is_trivially_copyable_v<symbol>);
+    }
+
+    THEN("it is no larger than a pointer")
+    {
+      STATIC_REQUIRE(sizeof(symbol) == sizeof(void *));
+    }
+
+    THEN("it is not implicitly convertible to std::string_view")
+    {
+      STATIC_REQUIRE_FALSE(std::is_convertible_v<symbol, std::string_view>);
+    }
+
+    THEN("it is not implicitly constructible from std::string_view")
+    {
+      STATIC_REQUIRE_FALSE(std::is_convertible_v<std::string_view, symbol>);
+    }
+
+    THEN("it is not comparable with interned strings of other tags")
+    {
+      STATIC_REQUIRE_FALSE(std::equality_comparable_with<symbol, interned_types::keyword>);
+    }
+  }
+
+  GIVEN("Two interned strings with the same contents")
+  {
+    auto const text = std::string{"a symbol that does not fit into the small string buffer"};
+    auto lhs = symbol{text};
+    auto rhs = symbol{std::string_view{text}};
+
+    THEN("they compare equal")
+    {
+      REQUIRE(lhs == rhs);
+    }
+
+    THEN("they share the same storage")
+    {
+      REQUIRE(lhs.view().data() == rhs.view().data());
+    }
+
+    THEN("their storage is distinct from the source")
+    {
+      REQUIRE(lhs.view().data() != text.data());
+    }
+
+    THEN("their view is equal to the source")
+    {
+      REQUIRE(lhs.view() == text);
+      REQUIRE(lhs.size() == text.size());
+    }
+
+    THEN("their hash is the hash of their contents")
+    {
+      REQUIRE(std::hash<symbol>{}(lhs) == std::hash<std::string_view>{}(text));
+    }
+
+    THEN("they occupy a single entry in the intern table")
+    {
+      auto size = symbol::pool_size();
+      auto other = symbol{text};
+      REQUIRE(symbol::pool_size() == size);
+      REQUIRE(other == lhs);
+    }
+  }
+
+  GIVEN("Two interned strings with different contents")
+  {
+    auto lhs = symbol{"alpha"};
+    auto rhs = symbol{"beta"};
+
+    THEN("they compare unequal")
+    {
+      REQUIRE(lhs != rhs);
+    }
+
+    THEN("they are ordered by their contents")
+    {
+      REQUIRE(lhs < rhs);
+      REQUIRE((rhs <=> lhs) == std::strong_ordering::greater);
+    }
+  }
+
+  GIVEN("A default constructed interned string")
+  {
+    auto value = symbol{};
+
+    THEN("it is empty")
+    {
+      REQUIRE(value.empty());
+      REQUIRE(value.view().empty());
+      REQUIRE(std::string_view{value.data()}.empty());
+    }
+
+    THEN("it is equal to an interned empty string")
+    {
+      REQUIRE(value == symbol{""});
+    }
+  }
+
+  GIVEN("Interned strings with the same contents but different tags")
+  {
+    auto lhs = symbol{"shared"};
+    auto rhs = interned_types::keyword{"shared"};
+
+    THEN("they use distinct intern tables")
+    {
+      REQUIRE(lhs.view().data() != rhs.view().data());
+    }
+  }
+
+  GIVEN("An interned string")
+  {
+    auto value = symbol{"printable"};
+
+    THEN("it can be written to an output stream")
+    {
+      auto output = std::ostringstream{};
+      output << value;
+      REQUIRE(output.str() == "printable");
+    }
+
+    THEN("it can not be written to a wide output stream")
+    {
+      STATIC_REQUIRE_FALSE(interned_types::streamable_to<std::wostringstream, symbol>);
+    }
+
+    THEN("it can be used as a key in an unordered container")
+    {
+      auto set = std::unordered_set<symbol>{value, symbol{"printable"}, symbol{"other"}};
+      REQUIRE(set.size() == 2);
+      REQUIRE(set.contains(symbol{"printable"}));
+    }
+  }
+
+  GIVEN("An interned string type without thread-safety")
+  {
+    using interned_types::local_symbol;
+
+    THEN("interning the same contents yields equal objects")
+    {
+      REQUIRE(local_symbol{"local"} == local_symbol{"local"});
+    }
+  }
+}
+
+SCENARIO("Concurrent Interning", "[interned]")
+{
+  using interned_types::symbol;
+
+  GIVEN("Multiple threads interning the same set of strings")
+  {
+    auto constexpr thread_count = 4;
+    auto constexpr string_count = 256;
+    auto results = std::vector<std::vector<symbol>>(thread_count);
+    auto threads = std::vector<std::thread>{};
+
+    for (auto & result : results)
+    {
+      threads.emplace_back([&result] {
+        for (auto index = 0; index < string_count; ++index)
+        {
+          result.emplace_back("concurrent-" + std::to_string(index));
+        }
+      });
+    }
+
+    for (auto & thread : threads)
+    {
+      thread.join();
+    }
+
+    THEN("all threads obtain identical objects")
+    {
+      for (auto const & result : results)
+      {
+        REQUIRE(result == results.front());
+      }
+    }
+  }
+}
@@ -5,7 +5,12 @@
 #include <algorithm>
 #include <array>
 #include <iterator>
+#include <list>
 #include <numeric>
+#include <ranges>
+#include <span>
+#include <string_view>
+#include <vector>
 
 namespace iterable_types
 {
@@ -53,6 +58,9 @@ namespace iterable_types
   auto constexpr rend(with_free const &) -> with_free::const_reverse_iterator;
   auto constexpr crend(with_free const &) -> with_free::const_reverse_iterator;
 
+  template<typename SubjectType>
+  concept has_member_data = requires(SubjectType subject) { subject.data(); };
+
 }  // namespace iterable_types
 
 SCENARIO("Iterators", "[iterators]")
@@ -1058,3 +1066,117 @@ SCENARIO("Iterator Semantics", "[iterators]")
     }
   }
 }
+
+SCENARIO("Ranges", "[iterators]")
+{
+  GIVEN("A new_type over std::vector not deriving nt::Iterable")
+  {
+    using type_alias = nt::new_type<std::vector<int>, struct tag>;
+
+    THEN("it is not a range")
+    {
+      STATIC_REQUIRE_FALSE(std::ranges::range<type_alias>);
+    }
+  }
+
+  GIVEN("A new_type over std::vector deriving nt::Iterable")
+  {
+    using type_alias = nt::new_type<std::vector<int>, struct tag, deriving(nt::Iterable)>;
+
+    THEN("it is a contiguous range")
+    {
+      STATIC_REQUIRE(std::ranges::contiguous_range<type_alias>);
+      STATIC_REQUIRE(std::ranges::contiguous_range<type_alias const>);
+    }
+
+    THEN("it is a sized range")
+    {
+      STATIC_REQUIRE(std::ranges::sized_range<type_alias>);
+      STATIC_REQUIRE(std::ranges::sized_range<type_alias const>);
+    }
+
+    THEN("it is not a borrowed range")
+    {
+      STATIC_REQUIRE_FALSE(std::ranges::borrowed_range<type_alias>);
+    }
+
+    THEN("it is not a view")
+    {
+      STATIC_REQUIRE_FALSE(std::ranges::view<type_alias>);
+    }
+
+    THEN("it can be viewed as a std::span")
+    {
+      STATIC_REQUIRE(std::is_constructible_v<std::span<int>, type_alias &>);
+      STATIC_REQUIRE(std::is_constructible_v<std::span<int const>, type_alias const &>);
+    }
+
+    THEN("data, size, and empty are forwarded to the base type")
+    {
+      auto obj = type_alias{{1, 2, 3}};
+      REQUIRE(obj.size() == 3);
+      REQUIRE_FALSE(obj.empty());
+      REQUIRE(obj.data() == std::ranges::data(obj));
+      REQUIRE(std::span<int>{obj}.size() == 3);
+    }
+
+    THEN("std::ranges algorithms yield the same results as for the base type")
+    {
+      auto const obj = type_alias{{3, 1, 2}};
+      auto target = std::vector<int>(3);
+      std::ranges::copy(obj, target.begin());
+      REQUIRE(std::ranges::equal(obj, target));
+      REQUIRE(std::ranges::distance(obj) == 3);
+    }
+  }
+
+  GIVEN("A new_type over std::list deriving nt::Iterable")
+  {
+    using type_alias = nt::new_type<std::list<int>, struct tag, deriving(nt::Iterable)>;
+
+    THEN("it is a bidirectional range")
+    {
+      STATIC_REQUIRE(std::ranges::bidirectional_range<type_alias>);
+    }
+
+    THEN("it is not a random access range")
+    {
+      STATIC_REQUIRE_FALSE(std::ranges::random_access_range<type_alias>);
+    }
+
+    THEN("it is a sized range")
+    {
+      STATIC_REQUIRE(std::ranges::sized_range<type_alias>);
+    }
+
+    THEN("it has no data member function")
+    {
+      STATIC_REQUIRE_FALSE(iterable_types::has_member_data<type_alias>);
+    }
+  }
+
+  GIVEN("A new_type over std::string_view deriving nt::Iterable")
+  {
+    using type_alias = nt::new_type<std::string_view, struct tag, deriving(nt::Iterable)>;
+
+    THEN("it is a borrowed range")
+    {
+      STATIC_REQUIRE(std::ranges::borrowed_range<type_alias>);
+    }
+
+    THEN("it is a view")
+    {
+      STATIC_REQUIRE(std::ranges::view<type_alias>);
+    }
+  }
+
+  GIVEN("A new_type over std::string_view not deriving nt::Iterable")
+  {
+    using type_alias = nt::new_type<std::string_view, struct tag>;
+
+    THEN("it is not a borrowed range")
+    {
+      STATIC_REQUIRE_FALSE(std::ranges::borrowed_range<type_alias>);
+    }
+  }
+}
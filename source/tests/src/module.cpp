@@ -0,0 +1,275 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <bit>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory_resource>
+#include <ranges>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <tuple>
+#include <type_traits>
+#include <unordered_set>
+#include <vector>
+
+import newtype;
+
+namespace module_types
+{
+
+  struct meters_tag
+  {
+  };
+
+  struct name_tag
+  {
+  };
+
+  using meters = nt::new_type<int, meters_tag, deriving(nt::Arithmetic, nt::Relational, nt::Hash, nt::Show, nt::Read, nt::Instrumented)>;
+  using row = nt::new_type<std::size_t, struct row_tag, deriving(nt::Index, nt::Relational)>;
+  using order_id = nt::new_type<std::uint32_t, struct order_id_tag, deriving(nt::Sentinel<0u>, nt::Relational, nt::Hash)>;
+  using quote_id = nt::new_type<std::uint32_t, struct quote_id_tag, deriving(nt::Relational, nt::Hash)>;
+  using ticker = nt::new_type<nt::fixed_string<7>, struct ticker_tag, deriving(nt::Read, nt::EqBase)>;
+  using volume = nt::new_type<long, struct volume_tag, deriving(nt::Read, nt::Show, nt::EqBase)>;
+  using name = nt::new_type<std::pmr::string, name_tag, deriving(nt::Accounted, nt::Indirection)>;
+  using samples = nt::new_type<std::vector<int>, struct samples_tag, deriving(nt::Container, nt::Iterable, nt::Subscript)>;
+  using symbol = nt::interned<struct symbol_tag>;
+
+}  // namespace module_types
+
+SCENARIO("Module", "[module]")
+{
+  using namespace module_types;
+
+  GIVEN("The library version")
+  {
+    THEN("it is exported")
+    {
+      STATIC_REQUIRE(nt::version.major == 2);
+    }
+  }
+
+  GIVEN("A new_type deriving operators")
+  {
+    nt::instrumentation::reset<meters_tag>();
+
+    THEN("the derived operators are exported")
+    {
+      auto value = meters{2} * meters{3} + meters{4} - meters{1};
+      value /= meters{3};
+      value += meters{1};
+      value -= meters{1};
+      value *= meters{1};
+      REQUIRE(value == meters{3});
+      REQUIRE(value != meters{4});
+      REQUIRE(value > meters{2});
+      REQUIRE(value >= meters{3});
+      REQUIRE(value < meters{4});
+      REQUIRE(value <= meters{3});
+    }
+
+    THEN("the std::hash specialization is reachable")
+    {
+      auto set = std::unordered_set<meters>{meters{1}, meters{1}, meters{2}};
+      REQUIRE(set.size() == 2);
+    }
+
+    THEN("the stream operators are exported")
+    {
+      auto input = std::istringstream{"42"};
+      auto value = meters{};
+      input >> value;
+      auto output = std::ostringstream{};
+      output << value;
+      REQUIRE(output.str() == "42");
+    }
+
+    THEN("nt::make is exported")
+    {
+      REQUIRE(nt::make<meters>(7) == meters{7});
+    }
+
+    THEN("the instrumentation counters are exported")
+    {
+      auto value = meters{1} + meters{2};
+      REQUIRE(value.decay() == 3);
+      REQUIRE(nt::instrumentation::snapshot<meters_tag>().arithmetic == 1);
+      REQUIRE(nt::instrumentation::snapshot<meters_tag>() != nt::instrumentation::counters{});
+    }
+
+    THEN("the derivation clause helpers are exported")
+    {
+      STATIC_REQUIRE(nt::derives<meters::derivation_clause_type, nt::Arithmetic>);
+      STATIC_REQUIRE(nt::concepts::addable<int>);
+    }
+  }
+
+  GIVEN("A new_type deriving nt::Container, nt::Iterable, and nt::Subscript")
+  {
+    auto values = samples{std::vector{1, 2, 3}};
+
+    THEN("its members and the free iterator functions are exported")
+    {
+      REQUIRE(values.size() == 3);
+      REQUIRE(values[1] == 2);
+      REQUIRE(*nt::begin(values) == 1);
+      REQUIRE(std::distance(nt::cbegin(values), nt::cend(values)) == 3);
+      REQUIRE(*nt::rbegin(values) == 3);
+      REQUIRE(std::distance(nt::crbegin(values), nt::crend(values)) == 3);
+      REQUIRE(nt::end(values) - nt::begin(values) == nt::rend(values) - nt::rbegin(values));
+    }
+  }
+
+  GIVEN("An indexed_vector")
+  {
+    auto values = nt::indexed_vector<row, int>{1, 2, 3};
+
+    THEN("it is subscriptable using its index type")
+    {
+      auto sum = 0;
+      for (auto index : nt::indices(row{0}, row{values.size()}))
+      {
+        sum += values[index];
+      }
+      REQUIRE(sum == 6);
+
+      auto index = row{0};
+      ++index;
+      --index;
+      REQUIRE(index == row{0});
+      STATIC_REQUIRE(nt::concepts::strong_index<row>);
+    }
+  }
+
+  GIVEN("An nt::optional over a new_type with a sentinel")
+  {
+    auto value = nt::optional<order_id>{order_id{17u}};
+    auto other = nt::optional<order_id>{};
+
+    THEN("it is exported together with its free functions")
+    {
+      swap(value, other);
+      REQUIRE_FALSE(value.has_value());
+      REQUIRE(other.value() == order_id{17u});
+      STATIC_REQUIRE(nt::concepts::sentinel_reserving<order_id>);
+    }
+  }
+
+  GIVEN("An nt::variant_of over new_types")
+  {
+    auto constexpr value = nt::variant_of<order_id, quote_id>{quote_id{5u}};
+
+    THEN("its accessors are exported")
+    {
+      STATIC_REQUIRE(nt::holds_alternative<quote_id>(value));
+      STATIC_REQUIRE(nt::get<quote_id>(value) == quote_id{5u});
+      STATIC_REQUIRE(nt::visit([](auto id) { return id.decay(); }, value) == 5u);
+      STATIC_REQUIRE(nt::concepts::variant_alternative<quote_id>);
+    }
+  }
+
+  GIVEN("A packed new_type")
+  {
+    auto constexpr value = nt::packed_be<quote_id>{quote_id{0x0102'0304u}};
+
+    THEN("the packed wrappers are exported")
+    {
+      STATIC_REQUIRE(value.bytes() == std::array{std::byte{1}, std::byte{2}, std::byte{3}, std::byte{4}});
+      STATIC_REQUIRE(nt::packed_le<quote_id>{quote_id{1u}}.load() == quote_id{1u});
+      STATIC_REQUIRE(std::is_same_v<nt::packed<quote_id, std::endian::big>, nt::packed_be<quote_id>>);
+      STATIC_REQUIRE(nt::concepts::packable<quote_id>);
+      STATIC_REQUIRE(nt::concepts::fully_representable<std::uint32_t>);
+    }
+  }
+
+  GIVEN("The bulk I/O functions")
+  {
+    THEN("read_all and write_all are exported")
+    {
+      auto values = std::vector<volume>{};
+      auto result = nt::read_all<volume>("1\n2\n3", std::back_inserter(values));
+      REQUIRE(result.error == std::errc{});
+      REQUIRE(values.size() == 3);
+      REQUIRE_THROWS_AS(nt::read_all<volume>("x"), nt::read_error);
+
+      auto output = std::string{};
+      auto written = nt::write_all(values, output, ',');
+      REQUIRE(written.error == std::errc{});
+      REQUIRE(output == "1,2,3");
+      STATIC_REQUIRE(std::is_same_v<decltype(result), nt::read_all_result<std::back_insert_iterator<std::vector<volume>>>>);
+      STATIC_REQUIRE(std::is_same_v<decltype(written), nt::write_all_result>);
+      STATIC_REQUIRE(nt::concepts::bulk_readable<volume>);
+      STATIC_REQUIRE(nt::concepts::bulk_writable<volume>);
+    }
+
+    THEN("read_columns is exported")
+    {
+      auto [tickers, volumes] = nt::read_columns<ticker, volume>("AAPL\t10\nMSFT\t20\n", nt::tsv);
+      REQUIRE(tickers.back() == ticker{nt::fixed_string<7>{"MSFT"}});
+      REQUIRE(std::is_lt(nt::fixed_string<7>{"AAPL"} <=> nt::fixed_string<7>{"MSFT"}));
+      REQUIRE(volumes.back() == volume{20});
+
+      auto columns = std::tuple<std::vector<ticker>, std::vector<volume>>{};
+      auto result = nt::read_columns("symbol,volume\nGOOG,30\n", columns, nt::column_format{',', true});
+      REQUIRE(result.error == std::errc{});
+      STATIC_REQUIRE(std::is_same_v<decltype(result), nt::read_columns_result>);
+      STATIC_REQUIRE(nt::csv.delimiter == ',');
+      STATIC_REQUIRE(nt::concepts::column_readable<ticker>);
+    }
+  }
+
+  GIVEN("An interned string type")
+  {
+    THEN("equal strings share their storage")
+    {
+      REQUIRE(symbol{"module"}.view().data() == symbol{std::string{"module"}}.view().data());
+    }
+  }
+
+  GIVEN("A new_type deriving nt::Accounted")
+  {
+    THEN("its allocations are accounted")
+    {
+      auto before = nt::accounting::snapshot<name_tag>();
+      auto value = name{std::pmr::string(100, 'x')};
+      REQUIRE(value->get_allocator().resource() == nt::accounting::resource<name_tag>());
+      REQUIRE(nt::accounting::snapshot<name_tag>().allocations > before.allocations);
+      STATIC_REQUIRE(std::is_same_v<decltype(before), nt::accounting::statistics>);
+      STATIC_REQUIRE_FALSE(nt::accounting::enable_peak_tracking<name_tag>);
+    }
+  }
+
+  GIVEN("A vector using a default_init_allocator")
+  {
+    using value_type = nt::new_type<double, struct value_tag, deriving(nt::DefaultInit)>;
+
+    THEN("it is exported")
+    {
+      auto values = std::vector<value_type, nt::default_init_allocator<value_type>>(4);
+      REQUIRE(values.size() == 4);
+    }
+  }
+
+  GIVEN("A critical section")
+  {
+    THEN("nt::no_copies_scope is exported")
+    {
+      auto scope = nt::no_copies_scope{};
+      REQUIRE(meters{1} == meters{1});
+    }
+
+#if defined(NEWTYPE_AUDIT_COPIES)
+    THEN("the copy audit is exported")
+    {
+      nt::copy_audit::reset();
+      REQUIRE(nt::copy_audit::snapshot().empty());
+    }
+#endif
+  }
+}
@@ -0,0 +1,212 @@
+#include "newtype/newtype.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace move_only_types
+{
+
+  struct buffer_tag;
+  using buffer = nt::new_type<std::string, buffer_tag, deriving(nt::MoveOnly, nt::Iterable, nt::Relational, nt::EqBase, nt::Hash)>;
+
+  struct matrix
+  {
+    std::vector<double> values;
+
+    auto operator+(matrix const & other) const -> matrix
+    {
+      auto result = matrix{values};
+      for (auto index = std::size_t{}; index < values.size(); ++index)
+      {
+        result.values[index] += other.values[index];
+      }
+      return result;
+    }
+
+    auto operator==(matrix const &) const -> bool = default;
+  };
+
+  using heavy_matrix = nt::new_type<matrix, struct heavy_matrix_tag, deriving(nt::MoveOnly, nt::Arithmetic)>;
+
+  using handle =
+      nt::new_type<std::unique_ptr<int>, struct handle_tag, deriving(nt::Relational, nt::EqBase, nt::Show, nt::Hash, nt::Indirection)>;
+
+  template<typename SubjectType>
+  concept lvalue_decayable = requires(SubjectType const & subject) { subject.decay(); };
+
+  template<typename SubjectType>
+  concept clonable = requires(SubjectType const & subject) { subject.clone(); };
+
+  template<typename SubjectType>
+  concept post_incrementable = requires(SubjectType & subject) { subject++; };
+
+  auto const long_text = std::string{"a string that is definitely too long for the small string optimization"};
+
+}  // namespace move_only_types
+
+SCENARIO("Move-only New Types", "[move_only]")
+{
+  using move_only_types::buffer;
+  using move_only_types::long_text;
+
+  GIVEN("A new_type over a copyable type deriving nt::MoveOnly")
+  {
+    THEN("it is not copy constructible")
+    {
+      STATIC_REQUIRE_FALSE(std::is_copy_constructible_v<buffer>);
+    }
+
+    THEN("it is not copy assignable")
+    {
+      STATIC_REQUIRE_FALSE(std::is_copy_assignable_v<buffer>);
+    }
+
+    THEN("it is move constructible and move assignable")
+    {
+      STATIC_REQUIRE(std::is_nothrow_move_constructible_v<buffer>);
+      STATIC_REQUIRE(std::is_nothrow_move_assignable_v<buffer>);
+    }
+
+    THEN("it can not be decayed from an lvalue")
+    {
+      STATIC_REQUIRE_FALSE(move_only_types::lvalue_decayable<buffer>);
+    }
+
+    THEN("it can be cloned")
+    {
+      STATIC_REQUIRE(move_only_types::clonable<buffer>);
+    }
+
+    THEN("it is not constructible from an lvalue of its base type")
+    {
+      STATIC_REQUIRE_FALSE(std::is_constructible_v<buffer, std::string const &>);
+      STATIC_REQUIRE(std::is_constructible_v<buffer, std::string &&>);
+    }
+  }
+
+  GIVEN("A new_type not deriving nt::MoveOnly")
+  {
+    THEN("it can not be cloned")
+    {
+      STATIC_REQUIRE_FALSE(move_only_types::clonable<nt::new_type<int, struct copyable_tag>>);
+    }
+  }
+
+  GIVEN("An object of a new_type deriving nt::MoveOnly")
+  {
+    auto object = buffer{std::string{long_text}};
+
+    WHEN("it is cloned")
+    {
+      auto clone = object.clone();
+
+      THEN("the clone compares equal to the original")
+      {
+        REQUIRE(clone == object);
+      }
+
+      THEN("the clone does not share storage with the original")
+      {
+        REQUIRE(clone.data() != object.data());
+      }
+    }
+
+    WHEN("it is decayed as an rvalue")
+    {
+      auto data = object.data();
+      auto value = std::move(object).decay();
+
+      THEN("the contained object is moved out")
+      {
+        REQUIRE(value == long_text);
+        REQUIRE(value.data() == data);
+      }
+    }
+
+    THEN("it can be compared without copying")
+    {
+      REQUIRE(object == long_text);
+      REQUIRE(object < buffer{long_text + "!"});
+      REQUIRE(object >= buffer{std::string{long_text}});
+    }
+
+    THEN("it can be hashed")
+    {
+      auto set = std::unordered_set<buffer>{};
+      set.insert(std::move(object));
+      REQUIRE(set.size() == 1);
+    }
+  }
+
+  GIVEN("Two objects of an arithmetic new_type deriving nt::MoveOnly")
+  {
+    using move_only_types::heavy_matrix;
+    using move_only_types::matrix;
+
+    auto lhs = heavy_matrix{matrix{{1.0, 2.0}}};
+    auto rhs = heavy_matrix{matrix{{3.0, 4.0}}};
+
+    THEN("they can be added")
+    {
+      auto sum = lhs + rhs;
+      REQUIRE(sum == heavy_matrix{matrix{{4.0, 6.0}}});
+    }
+  }
+
+  GIVEN("A new_type over a move-only type")
+  {
+    using move_only_types::handle;
+
+    auto lhs = handle{std::make_unique<int>(1)};
+    auto rhs = handle{std::make_unique<int>(2)};
+
+    THEN("it is not copy constructible")
+    {
+      STATIC_REQUIRE_FALSE(std::is_copy_constructible_v<handle>);
+    }
+
+    THEN("its relational operators are usable")
+    {
+      REQUIRE((lhs < rhs) == (lhs->get() < rhs->get()));
+      REQUIRE(lhs != rhs);
+      REQUIRE(lhs != std::unique_ptr<int>{});
+    }
+
+    THEN("it can be written to an output stream")
+    {
+      auto output = std::ostringstream{};
+      output << lhs;
+      REQUIRE_FALSE(output.str().empty());
+    }
+
+    THEN("it can be hashed")
+    {
+      REQUIRE(std::hash<handle>{}(lhs) == std::hash<int *>{}(lhs->get()));
+    }
+
+    THEN("its contained object can be moved out")
+    {
+      auto pointer = std::move(lhs).decay();
+      REQUIRE(*pointer == 1);
+    }
+  }
+
+  GIVEN("An index new_type deriving nt::MoveOnly")
+  {
+    using index = nt::new_type<int, struct index_tag, deriving(nt::Index, nt::MoveOnly)>;
+
+    THEN("it is not post-incrementable, since that would copy")
+    {
+      STATIC_REQUIRE_FALSE(move_only_types::post_incrementable<index>);
+    }
+  }
+}
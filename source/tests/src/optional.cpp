@@ -0,0 +1,275 @@
+#include "newtype/newtype.hpp"
+#include "newtype/optional.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <compare>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace optional_types
+{
+
+  using order_id = nt::new_type<std::uint32_t, struct order_id_tag, deriving(nt::Sentinel<0u>, nt::Relational, nt::Hash)>;
+  using slot = nt::new_type<std::int16_t, struct slot_tag, deriving(nt::Show, nt::Sentinel<std::numeric_limits<std::int16_t>::max()>)>;
+  using price = nt::new_type<double, struct price_tag, deriving(nt::Sentinel<std::numeric_limits<double>::quiet_NaN()>)>;
+  using plain = nt::new_type<std::uint32_t, struct plain_tag>;
+
+  template<typename SubjectType>
+  concept optionalizable = requires { typename nt::optional<SubjectType>; };
+
+  template<typename SubjectType>
+  concept three_way_comparable = requires(SubjectType lhs, SubjectType rhs) { lhs <=> rhs; };
+
+  template<typename SubjectType>
+  concept hashable = requires(SubjectType subject) { std::hash<SubjectType>{}(subject); };
+
+}  // namespace optional_types
+
+SCENARIO("Sentinel Optional", "[optional]")
+{
+  using optional_types::order_id;
+  using optional_types::price;
+  using optional_types::slot;
+
+  GIVEN("A new_type deriving nt::Sentinel")
+  {
+    using type_alias = nt::optional<order_id>;
+
+    THEN("its optional has the size and alignment of the new_type")
+    {
+      STATIC_REQUIRE(sizeof(type_alias) == sizeof(order_id));
+      STATIC_REQUIRE(alignof(type_alias) == alignof(order_id));
+    }
+
+    THEN("an array of its optionals contains no padding")
+    {
+      STATIC_REQUIRE(sizeof(std::array<type_alias, 16>) == 16 * sizeof(std::uint32_t));
+    }
+
+    THEN("its optional is trivially copyable")
+    {
+      STATIC_REQUIRE(std::is_trivially_copyable_v<type_alias>);
+    }
+
+    THEN("its optional exposes the sentinel")
+    {
+      STATIC_REQUIRE(type_alias::sentinel == 0u);
+      STATIC_REQUIRE(nt::optional<slot>::sentinel == std::numeric_limits<std::int16_t>::max());
+    }
+  }
+
+  GIVEN("A new_type not deriving nt::Sentinel")
+  {
+    THEN("it can not be used with nt::optional")
+    {
+      STATIC_REQUIRE_FALSE(optional_types::optionalizable<optional_types::plain>);
+    }
+  }
+
+  GIVEN("A default constructed optional")
+  {
+    auto constexpr object = nt::optional<order_id>{};
+
+    THEN("it is empty")
+    {
+      STATIC_REQUIRE_FALSE(object.has_value());
+      STATIC_REQUIRE_FALSE(static_cast<bool>(object));
+      STATIC_REQUIRE(object == std::nullopt);
+    }
+
+    THEN("value() throws")
+    {
+      REQUIRE_THROWS_AS(object.value(), std::bad_optional_access);
+    }
+
+    THEN("value_or() returns the fallback")
+    {
+      STATIC_REQUIRE(object.value_or(order_id{7}) == order_id{7});
+    }
+  }
+
+  GIVEN("An optional constructed from a value")
+  {
+    auto constexpr object = nt::optional<order_id>{order_id{42}};
+
+    THEN("it holds the value")
+    {
+      STATIC_REQUIRE(object.has_value());
+      STATIC_REQUIRE(*object == order_id{42});
+      STATIC_REQUIRE(object.value() == order_id{42});
+      STATIC_REQUIRE(object->decay() == 42u);
+      STATIC_REQUIRE(object.value_or(order_id{7}) == order_id{42});
+    }
+
+    THEN("it compares equal to the value")
+    {
+      STATIC_REQUIRE(object == order_id{42});
+      STATIC_REQUIRE(object != order_id{43});
+      STATIC_REQUIRE(object != std::nullopt);
+    }
+  }
+
+  GIVEN("An optional whose value is replaced by the sentinel through operator*")
+  {
+    auto object = nt::optional<order_id>{order_id{17u}};
+    *object = order_id{0u};
+
+    THEN("it is empty")
+    {
+      REQUIRE_FALSE(object.has_value());
+    }
+  }
+
+  GIVEN("An optional constructed in place")
+  {
+    auto constexpr object = nt::optional<order_id>{std::in_place, 17u};
+
+    THEN("it holds the value")
+    {
+      STATIC_REQUIRE(object == order_id{17});
+    }
+  }
+
+  GIVEN("An optional over a new_type using the maximum as its sentinel")
+  {
+    auto object = nt::optional<slot>{slot{0}};
+
+    THEN("zero is a valid value")
+    {
+      REQUIRE(object.has_value());
+    }
+
+    WHEN("it is reset")
+    {
+      object.reset();
+
+      THEN("it is empty")
+      {
+        REQUIRE_FALSE(object.has_value());
+        REQUIRE(object->decay() == std::numeric_limits<std::int16_t>::max());
+      }
+    }
+  }
+
+  GIVEN("An optional over a floating point new_type using NaN as its sentinel")
+  {
+    auto object = nt::optional<price>{};
+
+    THEN("it is empty")
+    {
+      REQUIRE_FALSE(object.has_value());
+    }
+
+    WHEN("a value is assigned")
+    {
+      object = price{1.5};
+
+      THEN("it holds the value")
+      {
+        REQUIRE(object.has_value());
+        REQUIRE(object == price{1.5});
+      }
+    }
+
+    WHEN("a computed NaN is stored through operator*")
+    {
+      auto const zero = 0.0;
+      object = price{1.5};
+      *object = price{zero / zero};
+
+      THEN("it is empty")
+      {
+        REQUIRE_FALSE(object.has_value());
+      }
+    }
+  }
+
+  GIVEN("An empty optional")
+  {
+    auto object = nt::optional<order_id>{};
+
+    WHEN("a value is emplaced")
+    {
+      auto & value = object.emplace(23u);
+
+      THEN("it holds the value")
+      {
+        REQUIRE(object.has_value());
+        REQUIRE(value == order_id{23});
+        REQUIRE(&value == &*object);
+      }
+
+      AND_WHEN("nullopt is assigned")
+      {
+        object = std::nullopt;
+
+        THEN("it is empty")
+        {
+          REQUIRE_FALSE(object.has_value());
+        }
+      }
+    }
+
+    WHEN("it is swapped with an engaged optional")
+    {
+      auto other = nt::optional<order_id>{order_id{5}};
+      swap(object, other);
+
+      THEN("the states are exchanged")
+      {
+        REQUIRE(object == order_id{5});
+        REQUIRE(other == std::nullopt);
+      }
+    }
+  }
+
+  GIVEN("Optionals over a new_type deriving nt::Relational")
+  {
+    auto constexpr empty = nt::optional<order_id>{};
+    auto constexpr small = nt::optional<order_id>{order_id{1}};
+    auto constexpr large = nt::optional<order_id>{order_id{2}};
+
+    THEN("empty optionals compare less than engaged ones")
+    {
+      STATIC_REQUIRE(empty < small);
+      STATIC_REQUIRE(empty == nt::optional<order_id>{});
+      STATIC_REQUIRE((empty <=> std::nullopt) == std::strong_ordering::equal);
+      STATIC_REQUIRE(small > std::nullopt);
+    }
+
+    THEN("engaged optionals compare by their values")
+    {
+      STATIC_REQUIRE(small < large);
+      STATIC_REQUIRE(large >= small);
+      STATIC_REQUIRE(small < order_id{2});
+    }
+  }
+
+  GIVEN("Optionals over a new_type not deriving nt::Relational")
+  {
+    THEN("they are not three-way comparable")
+    {
+      STATIC_REQUIRE_FALSE(optional_types::three_way_comparable<nt::optional<slot>>);
+    }
+  }
+
+  GIVEN("Optionals over a new_type deriving nt::Hash")
+  {
+    THEN("they are hashable")
+    {
+      STATIC_REQUIRE(optional_types::hashable<nt::optional<order_id>>);
+      REQUIRE(std::hash<nt::optional<order_id>>{}(nt::optional<order_id>{order_id{9}}) == std::hash<order_id>{}(order_id{9}));
+    }
+
+    THEN("optionals over other new_types are not hashable")
+    {
+      STATIC_REQUIRE_FALSE(optional_types::hashable<nt::optional<slot>>);
+    }
+  }
+}
@@ -0,0 +1,202 @@
+#include "newtype/newtype.hpp"
+#include "newtype/packed.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include <unordered_set>
+
+namespace packed_types
+{
+
+  using length = nt::new_type<std::uint16_t, struct length_tag, deriving(nt::Relational, nt::Hash)>;
+  using sequence = nt::new_type<std::int32_t, struct sequence_tag, deriving(nt::Relational)>;
+  using timestamp = nt::new_type<double, struct timestamp_tag>;
+
+  struct record
+  {
+    std::byte kind;
+    nt::packed_be<length> size;
+    nt::packed_le<sequence> number;
+  };
+
+  template<typename SubjectType>
+  concept less_than_comparable = requires(SubjectType lhs, SubjectType rhs) { lhs < rhs; };
+
+  template<typename SubjectType>
+  concept hashable = requires(SubjectType subject) { std::hash<SubjectType>{}(subject); };
+
+}  // namespace packed_types
+
+SCENARIO("Packed Storage", "[packed]")
+{
+  using packed_types::length;
+  using packed_types::sequence;
+
+  GIVEN("A new_type over a type with invalid object representations")
+  {
+    enum unfixed
+    {
+      first,
+      second,
+    };
+
+    THEN("it is not packable")
+    {
+      STATIC_REQUIRE_FALSE(nt::concepts::packable<nt::new_type<bool, struct tag>>);
+      STATIC_REQUIRE_FALSE(nt::concepts::packable<nt::new_type<unfixed, struct tag>>);
+    }
+  }
+
+  GIVEN("A new_type over a type without invalid object representations")
+  {
+    enum struct scoped : std::uint16_t
+    {
+      first,
+    };
+
+    THEN("it is packable")
+    {
+      STATIC_REQUIRE(nt::concepts::packable<nt::new_type<char, struct tag>>);
+      STATIC_REQUIRE(nt::concepts::packable<nt::new_type<double, struct tag>>);
+      STATIC_REQUIRE(nt::concepts::packable<nt::new_type<scoped, struct tag>>);
+    }
+  }
+
+  GIVEN("A packed new_type")
+  {
+    using type_alias = nt::packed_be<sequence>;
+
+    THEN("it has the size of the base type")
+    {
+      STATIC_REQUIRE(sizeof(type_alias) == sizeof(std::int32_t));
+    }
+
+    THEN("it has an alignment of 1")
+    {
+      STATIC_REQUIRE(alignof(type_alias) == 1);
+    }
+
+    THEN("it is trivially copyable and trivially default constructible")
+    {
+      STATIC_REQUIRE(std::is_trivially_copyable_v<type_alias>);
+      STATIC_REQUIRE(std::is_trivially_default_constructible_v<type_alias>);
+    }
+  }
+
+  GIVEN("A struct consisting of packed new_types")
+  {
+    using packed_types::record;
+
+    THEN("it contains no padding")
+    {
+      STATIC_REQUIRE(sizeof(record) == 1 + sizeof(std::uint16_t) + sizeof(std::int32_t));
+    }
+
+    THEN("it can be laid over raw bytes")
+    {
+      auto constexpr bytes = std::array<std::byte, 7>{
+          std::byte{0x01}, std::byte{0x12}, std::byte{0x34}, std::byte{0x78}, std::byte{0x56}, std::byte{0x34}, std::byte{0x12}};
+      auto constexpr decoded = std::bit_cast<record>(bytes);
+
+      STATIC_REQUIRE(decoded.size.load() == length{0x1234});
+      STATIC_REQUIRE(decoded.number.load() == sequence{0x12345678});
+    }
+  }
+
+  GIVEN("A big-endian packed new_type holding a value")
+  {
+    auto constexpr value = nt::packed_be<sequence>{sequence{0x0102'0304}};
+
+    THEN("its bytes are in big-endian order")
+    {
+      STATIC_REQUIRE(value.bytes() == std::array{std::byte{1}, std::byte{2}, std::byte{3}, std::byte{4}});
+    }
+
+    THEN("loading it produces the stored value")
+    {
+      STATIC_REQUIRE(value.load() == sequence{0x0102'0304});
+    }
+  }
+
+  GIVEN("A little-endian packed new_type holding a negative value")
+  {
+    auto constexpr value = nt::packed_le<sequence>{sequence{-2}};
+
+    THEN("its bytes are in little-endian order")
+    {
+      STATIC_REQUIRE(value.bytes() == std::array{std::byte{0xfe}, std::byte{0xff}, std::byte{0xff}, std::byte{0xff}});
+    }
+
+    THEN("loading it produces the stored value")
+    {
+      STATIC_REQUIRE(value.load() == sequence{-2});
+    }
+  }
+
+  GIVEN("A packed new_type over a floating point type")
+  {
+    auto value = nt::packed_be<packed_types::timestamp>{packed_types::timestamp{1.5}};
+
+    THEN("loading it produces the stored value")
+    {
+      REQUIRE(value.load() == packed_types::timestamp{1.5});
+    }
+
+    THEN("it is not relationally comparable if the new_type does not derive nt::Relational")
+    {
+      STATIC_REQUIRE_FALSE(packed_types::less_than_comparable<decltype(value)>);
+    }
+  }
+
+  GIVEN("A packed new_type deriving nt::Relational")
+  {
+    auto small = nt::packed_be<length>{length{0x00ff}};
+    auto large = nt::packed_be<length>{length{0x0100}};
+
+    THEN("it compares by value rather than by bytes")
+    {
+      REQUIRE(small < large);
+      REQUIRE(large > small);
+      REQUIRE(small != large);
+      REQUIRE(small < length{0x0100});
+      REQUIRE(length{0x00ff} == small);
+    }
+
+    WHEN("a new value is assigned")
+    {
+      small = length{0x0100};
+
+      THEN("it compares equal to an object holding the same value")
+      {
+        REQUIRE(small == large);
+      }
+    }
+  }
+
+  GIVEN("A packed new_type deriving nt::Hash")
+  {
+    auto value = nt::packed_be<length>{length{42}};
+
+    THEN("its hash is the hash of the new_type")
+    {
+      REQUIRE(std::hash<nt::packed_be<length>>{}(value) == std::hash<length>{}(length{42}));
+    }
+
+    THEN("it can be used as a key in an unordered container")
+    {
+      auto set = std::unordered_set<nt::packed_be<length>>{value, nt::packed_be<length>{length{42}}};
+      REQUIRE(set.size() == 1);
+    }
+
+    THEN("a packed new_type not deriving nt::Hash is not hashable")
+    {
+      STATIC_REQUIRE_FALSE(packed_types::hashable<nt::packed_be<sequence>>);
+    }
+  }
+}
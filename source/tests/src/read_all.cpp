@@ -0,0 +1,211 @@
+#include "newtype/newtype.hpp"
+#include "newtype/read_all.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdint>
+#include <cstdio>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+namespace read_all_types
+{
+
+  using count = nt::new_type<int, struct count_tag, deriving(nt::Read, nt::EqBase)>;
+  using ratio = nt::new_type<double, struct ratio_tag, deriving(nt::Read, nt::EqBase)>;
+  using small = nt::new_type<std::int8_t, struct small_tag, deriving(nt::Read)>;
+
+  struct temporary_file
+  {
+    explicit temporary_file(std::string_view contents)
+        : m_file{std::tmpfile()}
+    {
+      std::fwrite(contents.data(), 1, contents.size(), m_file);
+      std::fflush(m_file);
+      std::rewind(m_file);
+    }
+
+    ~temporary_file()
+    {
+      std::fclose(m_file);
+    }
+
+    temporary_file(temporary_file const &) = delete;
+    auto operator=(temporary_file const &) -> temporary_file & = delete;
+
+    auto descriptor() const -> int
+    {
+      return fileno(m_file);
+    }
+
+  private:
+    std::FILE * m_file;
+  };
+
+}  // namespace read_all_types
+
+SCENARIO("Bulk Reading", "[read_all]")
+{
+  using read_all_types::count;
+
+  GIVEN("A new_type not deriving nt::Read")
+  {
+    using type_alias = nt::new_type<int, struct tag>;
+
+    THEN("it is not bulk readable")
+    {
+      STATIC_REQUIRE_FALSE(nt::concepts::bulk_readable<type_alias>);
+    }
+  }
+
+  GIVEN("A new_type over a type not supported by std::from_chars deriving nt::Read")
+  {
+    using type_alias = nt::new_type<std::string, struct tag, deriving(nt::Read)>;
+
+    THEN("it is not bulk readable")
+    {
+      STATIC_REQUIRE_FALSE(nt::concepts::bulk_readable<type_alias>);
+    }
+  }
+
+  GIVEN("A buffer of newline separated values")
+  {
+    auto input = std::string_view{"1\n22\n-333\n"};
+
+    THEN("all values are read")
+    {
+      REQUIRE(nt::read_all<count>(input) == std::vector<count>{count{1}, count{22}, count{-333}});
+    }
+
+    THEN("all values are written to an output iterator")
+    {
+      auto values = std::vector<count>{count{0}};
+      auto result = nt::read_all<count>(input, std::back_inserter(values));
+
+      REQUIRE(result.error == std::errc{});
+      REQUIRE(result.offset == input.size());
+      REQUIRE(values == std::vector<count>{count{0}, count{1}, count{22}, count{-333}});
+    }
+  }
+
+  GIVEN("A buffer of values separated by CRLF line endings")
+  {
+    auto input = std::string_view{"1\r\n22\r\n-333"};
+
+    THEN("all values are read")
+    {
+      REQUIRE(nt::read_all<count>(input) == std::vector<count>{count{1}, count{22}, count{-333}});
+    }
+
+    THEN("a carriage return is not accepted before any other separator")
+    {
+      auto values = std::vector<count>{};
+      auto result = nt::read_all<count>(std::string_view{"1\r,2"}, std::back_inserter(values), ',');
+
+      REQUIRE(result.error == std::errc::invalid_argument);
+      REQUIRE(result.offset == 1);
+    }
+  }
+
+  GIVEN("A buffer of comma separated floating point values")
+  {
+    auto input = std::string_view{"0.5,1.25,-2"};
+
+    THEN("all values are read")
+    {
+      auto values = nt::read_all<read_all_types::ratio>(input, ',');
+      REQUIRE(values.size() == 3);
+      REQUIRE(values[0] == 0.5);
+      REQUIRE(values[1] == 1.25);
+      REQUIRE(values[2] == -2.0);
+    }
+  }
+
+  GIVEN("A buffer containing an invalid value")
+  {
+    auto input = std::string_view{"1\n2x\n3"};
+
+    THEN("the error and its offset are reported")
+    {
+      auto values = std::vector<count>{};
+      auto result = nt::read_all<count>(input, std::back_inserter(values));
+
+      REQUIRE(result.error == std::errc::invalid_argument);
+      REQUIRE(result.offset == 3);
+      REQUIRE(values == std::vector<count>{count{1}});
+    }
+
+    THEN("reading into a std::vector throws nt::read_error")
+    {
+      REQUIRE_THROWS_AS(nt::read_all<count>(input), nt::read_error);
+    }
+  }
+
+  GIVEN("A buffer containing an empty value")
+  {
+    auto input = std::string_view{"1\n\n3"};
+
+    THEN("the error and its offset are reported")
+    {
+      auto values = std::vector<count>{};
+      auto result = nt::read_all<count>(input, std::back_inserter(values));
+
+      REQUIRE(result.error == std::errc::invalid_argument);
+      REQUIRE(result.offset == 2);
+    }
+  }
+
+  GIVEN("A buffer containing a value out of range of the base type")
+  {
+    auto input = std::string_view{"1\n300"};
+
+    THEN("the error and its offset are reported")
+    {
+      auto values = std::vector<read_all_types::small>{};
+      auto result = nt::read_all<read_all_types::small>(input, std::back_inserter(values));
+
+      REQUIRE(result.error == std::errc::result_out_of_range);
+      REQUIRE(result.offset == 2);
+    }
+  }
+
+  GIVEN("A file of newline separated values")
+  {
+    auto contents = std::string{};
+    auto expected = std::vector<count>{};
+    for (auto index = 0; index < 1000; ++index)
+    {
+      contents += std::to_string(index * 7919) + '\n';
+      expected.emplace_back(index * 7919);
+    }
+    auto file = read_all_types::temporary_file{contents};
+
+    THEN("all values are read")
+    {
+      REQUIRE(nt::read_all<count>(file.descriptor()) == expected);
+    }
+
+    THEN("all values are read when using chunks smaller than a single value")
+    {
+      REQUIRE(nt::read_all<count>(file.descriptor(), '\n', 3) == expected);
+    }
+  }
+
+  GIVEN("A file containing an invalid value")
+  {
+    auto file = read_all_types::temporary_file{"10\n20\n3a0\n40"};
+
+    THEN("the error and its offset in the file are reported")
+    {
+      auto values = std::vector<count>{};
+      auto result = nt::read_all<count>(file.descriptor(), std::back_inserter(values), '\n', 4);
+
+      REQUIRE(result.error == std::errc::invalid_argument);
+      REQUIRE(result.offset == 7);
+      REQUIRE(values == std::vector<count>{count{10}, count{20}});
+    }
+  }
+}
@@ -0,0 +1,196 @@
+#include "newtype/fixed_string.hpp"
+#include "newtype/newtype.hpp"
+#include "newtype/read_columns.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <tuple>
+#include <vector>
+
+namespace read_columns_types
+{
+
+  using ticker = nt::new_type<nt::fixed_string<7>, struct ticker_tag, deriving(nt::Read, nt::EqBase)>;
+  using name = nt::new_type<std::string, struct name_tag, deriving(nt::Read, nt::EqBase)>;
+  using price = nt::new_type<double, struct price_tag, deriving(nt::Read, nt::EqBase)>;
+  using volume = nt::new_type<long, struct volume_tag, deriving(nt::Read, nt::EqBase)>;
+
+}  // namespace read_columns_types
+
+SCENARIO("Column Reading", "[read_columns]")
+{
+  using read_columns_types::name;
+  using read_columns_types::price;
+  using read_columns_types::ticker;
+  using read_columns_types::volume;
+
+  GIVEN("A new_type not deriving nt::Read")
+  {
+    using type_alias = nt::new_type<int, struct tag>;
+
+    THEN("it is not column readable")
+    {
+      STATIC_REQUIRE_FALSE(nt::concepts::column_readable<type_alias>);
+    }
+  }
+
+  GIVEN("A new_type over a string-like type deriving nt::Read")
+  {
+    THEN("it is column readable")
+    {
+      STATIC_REQUIRE(nt::concepts::column_readable<ticker>);
+      STATIC_REQUIRE(nt::concepts::column_readable<name>);
+    }
+  }
+
+  GIVEN("A buffer of comma separated values")
+  {
+    auto input = std::string_view{"AAPL,Apple,189.5,1000\nMSFT,Microsoft,411.25,2000\n"};
+
+    THEN("the values are read into strongly typed columns")
+    {
+      auto [tickers, names, prices, volumes] = nt::read_columns<ticker, name, price, volume>(input);
+
+      REQUIRE(tickers == std::vector<ticker>{ticker{"AAPL"}, ticker{"MSFT"}});
+      REQUIRE(names == std::vector<name>{name{"Apple"}, name{"Microsoft"}});
+      REQUIRE(prices == std::vector<price>{price{189.5}, price{411.25}});
+      REQUIRE(volumes == std::vector<volume>{volume{1000}, volume{2000}});
+    }
+  }
+
+  GIVEN("A buffer of tab separated values with a header and CRLF line endings")
+  {
+    auto input = std::string_view{"ticker\tvolume\r\nAAPL\t1000\r\nMSFT\t2000"};
+
+    THEN("the values are read into strongly typed columns")
+    {
+      auto [tickers, volumes] = nt::read_columns<ticker, volume>(input, nt::column_format{'\t', true});
+
+      REQUIRE(tickers == std::vector<ticker>{ticker{"AAPL"}, ticker{"MSFT"}});
+      REQUIRE(volumes == std::vector<volume>{volume{1000}, volume{2000}});
+    }
+  }
+
+  GIVEN("A buffer containing an invalid value")
+  {
+    auto input = std::string_view{"AAPL,1000\nMSFT,2x00\n"};
+
+    THEN("the error and its offset are reported and no partial row is added")
+    {
+      auto columns = std::tuple<std::vector<ticker>, std::vector<volume>>{};
+      auto result = nt::read_columns(input, columns);
+
+      REQUIRE(result.error == std::errc::invalid_argument);
+      REQUIRE(result.offset == 16);
+      REQUIRE(result.rows == 1);
+      REQUIRE(std::get<0>(columns).size() == 1);
+      REQUIRE(std::get<1>(columns).size() == 1);
+    }
+
+    THEN("reading into new columns throws nt::read_error")
+    {
+      REQUIRE_THROWS_AS((nt::read_columns<ticker, volume>(input)), nt::read_error);
+    }
+  }
+
+  GIVEN("A buffer containing a value exceeding the capacity of a fixed-capacity column")
+  {
+    using short_ticker = nt::new_type<nt::fixed_string<4>, struct short_ticker_tag, deriving(nt::Read, nt::EqBase)>;
+    auto input = std::string_view{"AAPL,1000\nABCDEFG,1\n"};
+
+    THEN("the error and its offset are reported instead of throwing")
+    {
+      auto columns = std::tuple<std::vector<short_ticker>, std::vector<volume>>{};
+      auto result = nt::read_columns(input, columns);
+
+      REQUIRE(result.error == std::errc::value_too_large);
+      REQUIRE(result.offset == 10);
+      REQUIRE(result.rows == 1);
+    }
+  }
+
+  GIVEN("A buffer containing a row with too few fields")
+  {
+    auto input = std::string_view{"AAPL,1000\nMSFT\n"};
+
+    THEN("the error is reported at the end of the row")
+    {
+      auto columns = std::tuple<std::vector<ticker>, std::vector<volume>>{};
+      auto result = nt::read_columns(input, columns);
+
+      REQUIRE(result.error == std::errc::invalid_argument);
+      REQUIRE(result.offset == 14);
+    }
+  }
+
+  GIVEN("A buffer containing a row with too many fields")
+  {
+    auto input = std::string_view{"AAPL,1000,3\n"};
+
+    THEN("the error is reported at the superfluous delimiter")
+    {
+      auto columns = std::tuple<std::vector<ticker>, std::vector<volume>>{};
+      auto result = nt::read_columns(input, columns);
+
+      REQUIRE(result.error == std::errc::invalid_argument);
+      REQUIRE(result.offset == 9);
+    }
+  }
+
+  GIVEN("A file of comma separated values with a header")
+  {
+    auto contents = std::string{"ticker,volume\n"};
+    auto expected_volumes = std::vector<volume>{};
+    for (auto index = 0; index < 1000; ++index)
+    {
+      contents += "T" + std::to_string(index % 100) + "," + std::to_string(index * 31) + "\n";
+      expected_volumes.emplace_back(index * 31);
+    }
+
+    auto file = std::tmpfile();
+    std::fwrite(contents.data(), 1, contents.size(), file);
+    std::fflush(file);
+
+    THEN("the values are read into strongly typed columns")
+    {
+      std::rewind(file);
+      auto [tickers, volumes] = nt::read_columns<ticker, volume>(fileno(file), nt::column_format{',', true});
+
+      REQUIRE(tickers.size() == 1000);
+      REQUIRE(tickers[123] == ticker{"T23"});
+      REQUIRE(volumes == expected_volumes);
+    }
+
+    THEN("the values are read when using chunks smaller than a single row")
+    {
+      std::rewind(file);
+      auto [tickers, volumes] = nt::read_columns<ticker, volume>(fileno(file), nt::column_format{',', true}, 4);
+
+      REQUIRE(tickers.size() == 1000);
+      REQUIRE(volumes == expected_volumes);
+    }
+
+    std::fclose(file);
+  }
+
+  GIVEN("An empty file")
+  {
+    auto file = std::tmpfile();
+
+    THEN("no rows are read and no error is reported")
+    {
+      auto columns = std::tuple<std::vector<ticker>, std::vector<volume>>{};
+      auto result = nt::read_columns(fileno(file), columns);
+
+      REQUIRE(result.error == std::errc{});
+      REQUIRE(result.offset == 0);
+      REQUIRE(result.rows == 0);
+    }
+
+    std::fclose(file);
+  }
+}
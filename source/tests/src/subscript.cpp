@@ -0,0 +1,127 @@
+#include "newtype/newtype.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <map>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace subscript_types
+{
+
+  template<typename SubjectType, typename IndexType>
+  concept subscriptable_with = requires(SubjectType subject, IndexType index) { subject[index]; };
+
+#if __cpp_multidimensional_subscript >= 202110L
+  struct grid
+  {
+    auto operator[](std::size_t row, std::size_t column) -> int &
+    {
+      return cells[row * 2 + column];
+    }
+
+    int cells[4]{};
+  };
+#endif
+
+}  // namespace subscript_types
+
+SCENARIO("Subscript", "[subscript]")
+{
+  using subscript_types::subscriptable_with;
+
+  GIVEN("A new_type over std::vector not deriving nt::Subscript")
+  {
+    using type_alias = nt::new_type<std::vector<int>, struct tag>;
+
+    THEN("it is not subscriptable")
+    {
+      STATIC_REQUIRE_FALSE(subscriptable_with<type_alias, std::size_t>);
+    }
+  }
+
+  GIVEN("A new_type over std::vector deriving nt::Subscript")
+  {
+    using type_alias = nt::new_type<std::vector<int>, struct tag, deriving(nt::Subscript)>;
+
+    THEN("it is subscriptable")
+    {
+      STATIC_REQUIRE(subscriptable_with<type_alias &, std::size_t>);
+      STATIC_REQUIRE(subscriptable_with<type_alias const &, std::size_t>);
+    }
+
+    THEN("subscripting yields a reference to the element of the base type")
+    {
+      STATIC_REQUIRE(std::is_same_v<int &, decltype(std::declval<type_alias &>()[0])>);
+      STATIC_REQUIRE(std::is_same_v<int const &, decltype(std::declval<type_alias const &>()[0])>);
+    }
+
+    THEN("subscripting is noexcept iff. subscripting the base type is noexcept")
+    {
+      STATIC_REQUIRE(noexcept(std::declval<type_alias &>()[0]) == noexcept(std::declval<std::vector<int> &>()[0]));
+    }
+  }
+
+  GIVEN("A new_type over a non-subscriptable type deriving nt::Subscript")
+  {
+    using type_alias = nt::new_type<int, struct tag, deriving(nt::Subscript)>;
+
+    THEN("it is not subscriptable")
+    {
+      STATIC_REQUIRE_FALSE(subscriptable_with<type_alias, std::size_t>);
+    }
+  }
+
+  GIVEN("An object of a new_type over std::vector deriving nt::Subscript")
+  {
+    using type_alias = nt::new_type<std::vector<int>, struct tag, deriving(nt::Subscript)>;
+    auto obj = type_alias{{1, 2, 3}};
+
+    THEN("subscripting yields the element at the index")
+    {
+      REQUIRE(obj[1] == 2);
+    }
+
+    THEN("elements can be modified in place")
+    {
+      obj[1] = 42;
+      REQUIRE(obj.decay()[1] == 42);
+    }
+  }
+
+  GIVEN("An object of a new_type over std::map deriving nt::Subscript")
+  {
+    using type_alias = nt::new_type<std::map<std::string, int>, struct tag, deriving(nt::Subscript)>;
+    auto obj = type_alias{};
+
+    THEN("subscripting with a key inserts a value")
+    {
+      obj["answer"] = 42;
+      REQUIRE(obj.decay().at("answer") == 42);
+    }
+
+    THEN("a const object is not subscriptable")
+    {
+      STATIC_REQUIRE_FALSE(subscriptable_with<type_alias const &, std::string>);
+    }
+  }
+}
+
+#if __cpp_multidimensional_subscript >= 202110L
+SCENARIO("Multidimensional Subscript", "[subscript]")
+{
+  GIVEN("An object of a new_type over a multidimensionally subscriptable type deriving nt::Subscript")
+  {
+    using type_alias = nt::new_type<subscript_types::grid, struct tag, deriving(nt::Subscript)>;
+    auto obj = type_alias{};
+
+    THEN("subscripting with multiple indices yields the element at the indices")
+    {
+      obj[1, 0] = 42;
+      REQUIRE(obj.decay().cells[2] == 42);
+    }
+  }
+}
+#endif
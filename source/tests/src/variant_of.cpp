@@ -0,0 +1,215 @@
+#include "newtype/newtype.hpp"
+#include "newtype/variant_of.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <compare>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <variant>
+
+namespace variant_of_types
+{
+
+  using order_id = nt::new_type<std::uint64_t, struct order_id_tag, deriving(nt::Relational, nt::Hash)>;
+  using quote_id = nt::new_type<std::uint64_t, struct quote_id_tag, deriving(nt::Relational, nt::Hash)>;
+  using trade_id = nt::new_type<std::uint64_t, struct trade_id_tag, deriving(nt::Relational, nt::Hash)>;
+  using venue_id = nt::new_type<std::uint64_t, struct venue_id_tag>;
+  using signed_id = nt::new_type<std::int32_t, struct signed_id_tag>;
+  using other_signed_id = nt::new_type<std::int32_t, struct other_signed_id_tag>;
+  using small_id = nt::new_type<std::uint32_t, struct small_id_tag>;
+
+  using any_id = nt::variant_of<order_id, quote_id, trade_id>;
+
+  template<typename... Types>
+  concept variant_constructible = requires { typename nt::variant_of<Types...>; };
+
+  template<typename SubjectType>
+  concept three_way_comparable = requires(SubjectType lhs, SubjectType rhs) { lhs <=> rhs; };
+
+  template<typename SubjectType>
+  concept hashable = requires(SubjectType subject) { std::hash<SubjectType>{}(subject); };
+
+  struct describe
+  {
+    auto operator()(order_id const & id) const -> std::string
+    {
+      return "order " + std::to_string(id.decay());
+    }
+
+    auto operator()(quote_id const & id) const -> std::string
+    {
+      return "quote " + std::to_string(id.decay());
+    }
+
+    auto operator()(trade_id const & id) const -> std::string
+    {
+      return "trade " + std::to_string(id.decay());
+    }
+  };
+
+}  // namespace variant_of_types
+
+SCENARIO("Compact Variant", "[variant_of]")
+{
+  using variant_of_types::any_id;
+  using variant_of_types::order_id;
+  using variant_of_types::quote_id;
+  using variant_of_types::trade_id;
+
+  GIVEN("A variant_of new_types over an unsigned integral type")
+  {
+    THEN("it packs the discriminator into the base type")
+    {
+      STATIC_REQUIRE(any_id::packs_discriminator);
+      STATIC_REQUIRE(any_id::discriminator_bits == 2);
+      STATIC_REQUIRE(sizeof(any_id) == sizeof(std::uint64_t));
+      STATIC_REQUIRE(sizeof(any_id) < sizeof(std::variant<order_id, quote_id, trade_id>));
+    }
+
+    THEN("it is trivially copyable")
+    {
+      STATIC_REQUIRE(std::is_trivially_copyable_v<any_id>);
+    }
+
+    THEN("values reaching into the discriminator bits are rejected")
+    {
+      REQUIRE_THROWS_AS(any_id{order_id{std::numeric_limits<std::uint64_t>::max()}}, std::out_of_range);
+      REQUIRE_NOTHROW(any_id{order_id{std::numeric_limits<std::uint64_t>::max() >> 2}});
+    }
+  }
+
+  GIVEN("A variant_of new_types over a signed type")
+  {
+    using type_alias = nt::variant_of<variant_of_types::signed_id, variant_of_types::other_signed_id>;
+
+    THEN("it stores the discriminator in a side field")
+    {
+      STATIC_REQUIRE_FALSE(type_alias::packs_discriminator);
+      STATIC_REQUIRE(sizeof(type_alias) == 2 * sizeof(std::int32_t));
+    }
+
+    THEN("it can hold negative values")
+    {
+      auto object = type_alias{variant_of_types::other_signed_id{-42}};
+      REQUIRE(object.index() == 1);
+      REQUIRE(object.get<variant_of_types::other_signed_id>() == variant_of_types::other_signed_id{-42});
+    }
+  }
+
+  GIVEN("New types not sharing a base type")
+  {
+    THEN("they can not be combined")
+    {
+      STATIC_REQUIRE_FALSE(variant_of_types::variant_constructible<order_id, variant_of_types::small_id>);
+    }
+  }
+
+  GIVEN("Repeated new types")
+  {
+    THEN("they can not be combined")
+    {
+      STATIC_REQUIRE_FALSE(variant_of_types::variant_constructible<order_id, order_id>);
+    }
+  }
+
+  GIVEN("A default constructed variant_of")
+  {
+    auto constexpr object = any_id{};
+
+    THEN("it holds a default constructed first alternative")
+    {
+      STATIC_REQUIRE(object.index() == 0);
+      STATIC_REQUIRE(object.get<order_id>() == order_id{});
+    }
+  }
+
+  GIVEN("A variant_of holding a value")
+  {
+    auto constexpr object = any_id{quote_id{1234}};
+
+    THEN("it knows the alternative it holds")
+    {
+      STATIC_REQUIRE(object.index() == 1);
+      STATIC_REQUIRE(object.holds<quote_id>());
+      STATIC_REQUIRE(nt::holds_alternative<quote_id>(object));
+      STATIC_REQUIRE_FALSE(nt::holds_alternative<trade_id>(object));
+    }
+
+    THEN("the value can be retrieved")
+    {
+      STATIC_REQUIRE(object.get<quote_id>() == quote_id{1234});
+      STATIC_REQUIRE(object.get<1>() == quote_id{1234});
+      STATIC_REQUIRE(nt::get<quote_id>(object) == quote_id{1234});
+    }
+
+    THEN("retrieving another alternative throws")
+    {
+      REQUIRE_THROWS_AS(object.get<order_id>(), std::bad_variant_access);
+    }
+
+    THEN("it can be visited")
+    {
+      REQUIRE(nt::visit(variant_of_types::describe{}, object) == "quote 1234");
+      STATIC_REQUIRE(nt::visit([](auto id) { return id.decay() * 2; }, object) == 2468);
+    }
+
+    WHEN("another alternative is assigned")
+    {
+      auto copy = object;
+      copy = trade_id{7};
+
+      THEN("it holds the new alternative")
+      {
+        REQUIRE(copy.index() == 2);
+        REQUIRE(nt::visit(variant_of_types::describe{}, copy) == "trade 7");
+      }
+    }
+  }
+
+  GIVEN("Variants of new_types deriving nt::Relational")
+  {
+    THEN("they compare by alternative, then by value")
+    {
+      STATIC_REQUIRE(any_id{order_id{1}} == any_id{order_id{1}});
+      STATIC_REQUIRE(any_id{order_id{1}} != any_id{quote_id{1}});
+      STATIC_REQUIRE(any_id{order_id{9}} < any_id{quote_id{1}});
+      STATIC_REQUIRE(any_id{trade_id{1}} < any_id{trade_id{2}});
+      STATIC_REQUIRE((any_id{trade_id{3}} <=> any_id{trade_id{3}}) == std::strong_ordering::equal);
+    }
+  }
+
+  GIVEN("Variants of new_types not all deriving nt::Relational")
+  {
+    using type_alias = nt::variant_of<order_id, variant_of_types::venue_id>;
+
+    THEN("they are not three-way comparable")
+    {
+      STATIC_REQUIRE_FALSE(variant_of_types::three_way_comparable<type_alias>);
+    }
+
+    THEN("they are not hashable")
+    {
+      STATIC_REQUIRE_FALSE(variant_of_types::hashable<type_alias>);
+    }
+  }
+
+  GIVEN("Variants of new_types deriving nt::Hash")
+  {
+    THEN("they are hashable")
+    {
+      STATIC_REQUIRE(variant_of_types::hashable<any_id>);
+    }
+
+    THEN("equal values in different alternatives hash differently")
+    {
+      auto hasher = std::hash<any_id>{};
+      REQUIRE(hasher(any_id{order_id{5}}) == hasher(any_id{order_id{5}}));
+      REQUIRE(hasher(any_id{order_id{5}}) != hasher(any_id{quote_id{5}}));
+    }
+  }
+}
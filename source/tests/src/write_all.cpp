@@ -0,0 +1,186 @@
+#include "newtype/newtype.hpp"
+#include "newtype/read_all.hpp"
+#include "newtype/write_all.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <cstdio>
+#include <limits>
+#include <string>
+#include <system_error>
+#include <vector>
+
+namespace write_all_types
+{
+
+  using count = nt::new_type<int, struct count_tag, deriving(nt::Show, nt::Read, nt::EqBase)>;
+  using ratio = nt::new_type<double, struct ratio_tag, deriving(nt::Show, nt::Read, nt::EqBase)>;
+
+  struct banner_base
+  {
+    std::size_t length;
+  };
+
+  auto to_chars(char * first, char * last, banner_base const & value) -> std::to_chars_result
+  {
+    if (static_cast<std::size_t>(last - first) < value.length)
+    {
+      return {last, std::errc::value_too_large};
+    }
+    if (value.length == 0)
+    {
+      return {first, std::errc::invalid_argument};
+    }
+    return {std::fill_n(first, value.length, '#'), std::errc{}};
+  }
+
+  using banner = nt::new_type<banner_base, struct banner_tag, deriving(nt::Show)>;
+
+}  // namespace write_all_types
+
+SCENARIO("Bulk Writing", "[write_all]")
+{
+  using write_all_types::count;
+
+  GIVEN("A new_type not deriving nt::Show")
+  {
+    using type_alias = nt::new_type<int, struct tag>;
+
+    THEN("it is not bulk writable")
+    {
+      STATIC_REQUIRE_FALSE(nt::concepts::bulk_writable<type_alias>);
+    }
+  }
+
+  GIVEN("A new_type over a type not supported by std::to_chars deriving nt::Show")
+  {
+    using type_alias = nt::new_type<std::string, struct tag, deriving(nt::Show)>;
+
+    THEN("it is not bulk writable")
+    {
+      STATIC_REQUIRE_FALSE(nt::concepts::bulk_writable<type_alias>);
+    }
+  }
+
+  GIVEN("A range of objects of a new_type deriving nt::Show")
+  {
+    auto values = std::vector<count>{count{1}, count{-22}, count{333}};
+
+    THEN("writing them to a std::string separates them using the separator")
+    {
+      auto output = std::string{"> "};
+      auto result = nt::write_all(values, output, ',');
+      REQUIRE(output == "> 1,-22,333");
+      REQUIRE(result.size == 9);
+      REQUIRE(result.error == std::errc{});
+    }
+  }
+
+  GIVEN("An empty range of objects of a new_type deriving nt::Show")
+  {
+    auto values = std::vector<count>{};
+
+    THEN("writing them to a std::string produces no output")
+    {
+      auto output = std::string{};
+      nt::write_all(values, output);
+      REQUIRE(output.empty());
+    }
+  }
+
+  GIVEN("A range of floating point objects exceeding the size of the internal buffer")
+  {
+    auto values = std::vector<write_all_types::ratio>{};
+    for (auto index = 0; index < 10000; ++index)
+    {
+      values.emplace_back(index * std::numeric_limits<double>::epsilon());
+    }
+
+    THEN("they can be read back unchanged")
+    {
+      auto output = std::string{};
+      nt::write_all(values, output);
+      REQUIRE(nt::read_all<write_all_types::ratio>(output) == values);
+    }
+  }
+
+  GIVEN("A range of objects exceeding the size of the buffer and a file")
+  {
+    auto values = std::vector<count>{};
+    for (auto index = 0; index < 10000; ++index)
+    {
+      values.emplace_back(index * 7919);
+    }
+    auto file = std::tmpfile();
+
+    THEN("they can be written to the file and read back unchanged")
+    {
+      auto result = nt::write_all(values, fileno(file), '\n', 512);
+      std::rewind(file);
+
+      REQUIRE(result.error == std::errc{});
+      REQUIRE(nt::read_all<count>(fileno(file)) == values);
+    }
+
+    std::fclose(file);
+  }
+
+  GIVEN("A range of objects whose textual representation exceeds the size of the buffer")
+  {
+    using write_all_types::banner;
+    auto values = std::vector<banner>{banner{{10}}, banner{{5000}}, banner{{3}}};
+    auto expected = std::string(10, '#') + '\n' + std::string(5000, '#') + '\n' + std::string(3, '#');
+
+    THEN("writing them to a std::string produces the complete output")
+    {
+      auto output = std::string{};
+      auto result = nt::write_all(values, output);
+      REQUIRE(result.error == std::errc{});
+      REQUIRE(output == expected);
+    }
+
+    THEN("writing them to a file produces the complete output")
+    {
+      auto file = std::tmpfile();
+      auto result = nt::write_all(values, fileno(file), '\n', 512);
+      std::rewind(file);
+
+      auto output = std::string(expected.size() + 1, '\0');
+      output.resize(std::fread(output.data(), 1, output.size(), file));
+      std::fclose(file);
+
+      REQUIRE(result.error == std::errc{});
+      REQUIRE(result.size == expected.size());
+      REQUIRE(output == expected);
+    }
+  }
+
+  GIVEN("A range of objects one of which cannot be formatted")
+  {
+    using write_all_types::banner;
+    auto values = std::vector<banner>{banner{{2}}, banner{{0}}, banner{{3}}};
+
+    THEN("writing them to a std::string stops at the first error")
+    {
+      auto output = std::string{};
+      auto result = nt::write_all(values, output);
+      REQUIRE(result.error == std::errc::invalid_argument);
+      REQUIRE(output == "##");
+    }
+  }
+
+  GIVEN("An invalid file descriptor")
+  {
+    auto values = std::vector<count>{count{1}};
+
+    THEN("the error is reported")
+    {
+      auto result = nt::write_all(values, -1);
+      REQUIRE(result.error == std::errc::bad_file_descriptor);
+      REQUIRE(result.size == 0);
+    }
+  }
+}